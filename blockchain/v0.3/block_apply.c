@@ -0,0 +1,108 @@
+#include "blockchain.h"
+
+/* Defined in block_is_valid.c */
+int block_check(block_t const *block, block_t const *prev_block,
+				llist_t *all_unspent, utxo_index_t const *index,
+				sig_batch_t *batch, spent_set_t *spent);
+/* Defined in block_apply_utxos.c */
+void unlist_spent(blockchain_t *blockchain, spent_set_t *spent,
+				  utxo_t *utxo);
+int list_tx_outputs(llist_node_t node, unsigned int idx, void *arg);
+void unlist_new_utxos(void **arg);
+/* Defined after */
+int block_apply_utxos(blockchain_t *blockchain, block_t *block,
+					  spent_set_t *spent);
+void unspent_remove_spent(blockchain_t *blockchain, spent_set_t *spent);
+
+/**
+ * block_apply - Validates a Block, and adds it to the Blockchain
+ * @blockchain: Pointer to the Blockchain to update
+ * @block: Block to add after the last Block of blockchain,
+ *		   owned by blockchain on success
+ * @nthreads: Number of threads verifying signatures,
+ *			  0 to use every online CPU
+ *
+ * Description: Performs the checks of block_is_valid_parallel(), while
+ * recording the unspent output each input resolves to. Those outputs are
+ * then removed without being looked up again, and the outputs created
+ * by the Block are added, updating blockchain->unspent and its index.
+ *
+ * Nothing is changed unless the Block is valid and fully applied:
+ * everything that may fail is done before the first irreversible change.
+ *
+ * Return: 0 on success, -1 if the Block is invalid or on failure
+*/
+int block_apply(blockchain_t *blockchain, block_t *block,
+				unsigned int nthreads)
+{
+	sig_batch_t batch = {0};
+	spent_set_t spent = {0};
+	int ret = -1;
+
+	if (!blockchain || !block || !blockchain->unspent_index)
+		return (-1);
+
+	if (block_check(block, llist_get_tail(blockchain->chain), NULL,
+					blockchain->unspent_index, &batch, &spent) == 0 &&
+		ec_verify_parallel(batch.items, batch.size, nthreads, NULL) == 1)
+		ret = block_apply_utxos(blockchain, block, &spent);
+
+	free(batch.items);
+	spent_set_clear(&spent);
+	return (ret);
+}
+
+/**
+ * block_apply_utxos - Applies the changes of a valid Block to the unspent
+ *					   outputs, and appends it to the chain
+ * @blockchain: Pointer to the Blockchain to update
+ * @block: Valid Block to append
+ * @spent: Outputs spent by block, resolved to the unspent outputs
+ *
+ * Return: 0 on success, -1 on failure, blockchain being left untouched
+*/
+int block_apply_utxos(blockchain_t *blockchain, block_t *block,
+					  spent_set_t *spent)
+{
+	size_t nb_indexed = 0, nb_listed = 0;
+	void *arg[8];
+
+	arg[2] = block->hash, arg[3] = blockchain->unspent;
+	arg[4] = &nb_indexed, arg[5] = blockchain->unspent_index;
+	arg[7] = &nb_listed;
+	if (block_for_each_tx(block, list_tx_outputs, arg) == -1 ||
+		llist_add_node(blockchain->chain, block, ADD_NODE_REAR) == -1)
+	{
+		unlist_new_utxos(arg);
+		return (-1);
+	}
+
+	/* Nothing can fail past this point */
+	unspent_remove_spent(blockchain, spent);
+	/* Indexed now, or caught up by the next lookup if this fails */
+	chain_index_sync(blockchain->chain_index, blockchain->chain);
+
+	return (0);
+}
+
+/**
+ * unspent_remove_spent - Removes the outputs spent by a Block from the
+ *						  unspent outputs and their index, and frees them
+ * @blockchain: Pointer to the Blockchain to update
+ * @spent: Outputs spent by the Block, resolved to the unspent outputs
+ *
+ * Description: Each output is removed in constant time, the rest of the
+ * unspent outputs is not walked.
+*/
+void unspent_remove_spent(blockchain_t *blockchain, spent_set_t *spent)
+{
+	spent_outpoint_t *slot;
+	size_t i;
+
+	for (i = 0; i < spent->table.capacity; i++)
+	{
+		slot = probe_at(&spent->table, &spent_set_ops, i);
+		if (slot->in && slot->utxo)
+			unlist_spent(blockchain, spent, slot->utxo);
+	}
+}
@@ -0,0 +1,131 @@
+#include "blockchain.h"
+
+/* Defined after */
+int list_tx_output(llist_node_t node, unsigned int idx, void *arg);
+int is_utxo(llist_node_t node, void *arg);
+
+/**
+ * unlist_spent - Removes an output spent by a Block from the unspent
+ *				  outputs and their index, and frees it
+ * @blockchain: Pointer to the Blockchain to update
+ * @spent: Outputs spent by the Block, resolved to the unspent outputs
+ * @utxo: Spent output, resolved by an input of the Block
+ *
+ * Description: utxo_index_unlist() moves the output at the head of the
+ * unspent list into the record of utxo. If the Block also spends that
+ * output, its entry of the spent set is pointed at its new record. Entries
+ * are compared by address, so that an output identical to the moved one
+ * is left alone.
+*/
+void unlist_spent(blockchain_t *blockchain, spent_set_t *spent,
+				  utxo_t *utxo)
+{
+	utxo_t *head = llist_get_head(blockchain->unspent);
+	spent_outpoint_t *moved = NULL;
+	tx_in_t key;
+
+	if (head != utxo)
+	{
+		memcpy(key.block_hash, head->block_hash, SHA256_DIGEST_LENGTH);
+		memcpy(key.tx_id, head->tx_id, SHA256_DIGEST_LENGTH);
+		memcpy(key.tx_out_hash, head->out.hash, SHA256_DIGEST_LENGTH);
+		moved = spent_set_find(spent, &key);
+		if (moved && moved->utxo != head)
+			moved = NULL;
+	}
+
+	utxo_index_remove_utxo(blockchain->unspent_index, utxo);
+	utxo_index_unlist(blockchain->unspent_index, blockchain->unspent, utxo);
+	if (moved)
+		moved->utxo = utxo;
+}
+
+/**
+ * list_tx_outputs - Appends the outputs of a transaction to the unspent
+ *					 outputs
+ * @node: void pointer to the current transaction
+ * @idx: index of the node (unused)
+ * @arg: arguments of list_tx_output(), the transaction id is stored at [6]
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int list_tx_outputs(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t *tx = node;
+	void **ptr = arg;
+
+	ptr[6] = tx->id;
+	return (tx_outputs_for_each(tx, list_tx_output, arg) == -1 ? -1 : 0);
+	(void)idx;
+}
+
+/**
+ * list_tx_output - Creates the unspent output matching a transaction output,
+ *					appends it to the unspent list and indexes it
+ * @node: void pointer to the current tx_out_t
+ * @idx: index of the node (unused)
+ * @arg: array holding the Block hash at [2], the unspent list at [3],
+ *		 the number of new outputs indexed at [4], the index at [5],
+ *		 the transaction id at [6] and the number of new outputs
+ *		 appended at [7]
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int list_tx_output(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	utxo_t *utxo = unspent_tx_out_create(ptr[2], ptr[6], node);
+
+	if (!utxo)
+		return (-1);
+
+	if (llist_add_node(ptr[3], utxo, ADD_NODE_REAR) == -1)
+	{
+		free(utxo);
+		return (-1);
+	}
+	(*(size_t *) ptr[7])++;
+	if (utxo_index_add(ptr[5], utxo) == -1)
+		return (-1);
+	(*(size_t *) ptr[4])++;
+
+	return (0);
+	(void)idx;
+}
+
+/**
+ * unlist_new_utxos - Removes the outputs appended by list_tx_output() from
+ *					  the unspent list and the index, and frees them
+ * @arg: arguments of list_tx_output()
+ *
+ * Description: llist_remove_node() only unlinks the head of a list
+ * correctly, so the list is reversed to remove the new outputs from its
+ * head. This is only done on failure.
+*/
+void unlist_new_utxos(void **arg)
+{
+	size_t nb_listed = *(size_t *) arg[7], nb_indexed = *(size_t *) arg[4];
+	utxo_t *utxo;
+
+	llist_reverse(arg[3]);
+	while (nb_listed--)
+	{
+		utxo = llist_get_head(arg[3]);
+		if (nb_listed < nb_indexed)
+			utxo_index_remove_utxo(arg[5], utxo);
+		llist_remove_node(arg[3], is_utxo, utxo, 1, free);
+	}
+	llist_reverse(arg[3]);
+}
+
+/**
+ * is_utxo - Identifies an unspent output by its address
+ * @node: void pointer to the current utxo_t
+ * @arg: void pointer to the utxo_t to find
+ *
+ * Return: 1 if node is the output looked for, 0 otherwise
+*/
+int is_utxo(llist_node_t node, void *arg)
+{
+	return (node == arg);
+}
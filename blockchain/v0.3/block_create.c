@@ -23,18 +23,28 @@
  *
  *				Initializes the Block’s transaction list to an empty linked list.
  *
+ *				The Block is allocated from its own arena, sized for the Block
+ *				and its coinbase transaction, that can be used to allocate
+ *				the rest of its transactions.
+ *
+ *				The new Block has the version of the previous Block.
+ *
  *
  */
 block_t
 *block_create(block_t const *prev, int8_t const *data, uint32_t data_len)
 {
-	block_t *new_block = malloc(sizeof(block_t));
+	arena_t *arena = arena_create(BLOCK_ARENA_SIZE(1));
+	block_t *new_block;
 
+	/* Struct members are initialized to zero */
+	new_block = arena ? arena_alloc(arena, sizeof(block_t)) : NULL;
 	if (!new_block)
+	{
+		arena_destroy(arena);
 		return (NULL);
-
-	/* Initialize struct members to zero */
-	memset(new_block, 0, sizeof(block_t));
+	}
+	new_block->arena = arena;
 
 	/* Block info initialisation*/
 	if (prev)
@@ -57,9 +67,10 @@ block_t
 
 	/* transaction empty list creation */
 	new_block->transactions = llist_create(MT_SUPPORT_FALSE);
-	if (!new_block->transactions)
+	if (!new_block->transactions ||
+		(prev && block_set_version(new_block, prev->version) == -1))
 	{
-		free(new_block);
+		block_destroy(new_block);
 		return (NULL);
 	}
 
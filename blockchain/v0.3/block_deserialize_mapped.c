@@ -0,0 +1,187 @@
+#include "blockchain.h"
+
+/* Defined after */
+int tx_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+						  arena_t *arena);
+int inputs_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+							  int32_t nb_inputs);
+int outputs_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+							   int32_t nb_outputs);
+
+/**
+ * block_deserialize_mapped - Loads a Block from a mapped file
+ * @reader: Pointer to the reader
+ *
+ * Description: The Block, its transactions and their outputs are allocated
+ * from an arena, sized after the number of transactions of the Block. The
+ * transactions, and the outputs of each transaction, are stored in arrays
+ * the lists of the Block and of its transactions point into.
+ *
+ * The Merkle tree of a Merkle Block is not kept, it is rebuilt when needed.
+ *
+ * Return: Pointer to the Block, or NULL on failure
+*/
+block_t *block_deserialize_mapped(hblk_reader_t *reader)
+{
+	block_t header, *block;
+	arena_t *arena;
+	int32_t nb_transactions, i;
+
+	memset(&header, 0, sizeof(header));
+	if (hblk_reader_read(reader, &header.info, sizeof(header.info)) == -1 ||
+		hblk_reader_read(reader, &header.data.len,
+						 sizeof(header.data.len)) == -1)
+		return (NULL);
+	if (reader->endian != HBLK_ENDIAN)
+		SWAPENDIAN(header.info), SWAPENDIAN(header.data.len);
+
+	if (header.data.len > BLOCKCHAIN_DATA_MAX ||
+		hblk_reader_read(reader, header.data.buffer, header.data.len) == -1 ||
+		hblk_reader_read(reader, header.hash, SHA256_DIGEST_LENGTH) == -1 ||
+		(reader->versioned &&
+		 (hblk_reader_read(reader, &header.version, 1) == -1 ||
+		  header.version > BLOCK_VERSION_MAX)) ||
+		hblk_reader_int32(reader, &nb_transactions) == -1)
+		return (NULL);
+
+	arena = arena_create(BLOCK_ARENA_SIZE(nb_transactions > 0 ?
+										  (size_t)nb_transactions : 0));
+	block = arena ? arena_alloc(arena, sizeof(*block)) : NULL;
+	if (!block)
+	{
+		arena_destroy(arena);
+		return (NULL);
+	}
+	*block = header;
+	block->arena = arena;
+	block->nb_transactions = -1;
+	if (nb_transactions > -1 &&
+		(!(block->transactions = llist_create(MT_SUPPORT_FALSE)) ||
+		 (nb_transactions > 0 && !(block->transaction_array = arena_alloc(
+			arena, nb_transactions * sizeof(transaction_t))))))
+	{
+		block_destroy(block);
+		return (NULL);
+	}
+
+	for (i = 0; i < nb_transactions; i++)
+	{
+		if (tx_deserialize_mapped(reader, &block->transaction_array[i],
+								  arena) == -1 ||
+			llist_add_node(block->transactions, &block->transaction_array[i],
+						   ADD_NODE_REAR) == -1)
+		{
+			transaction_destroy(&block->transaction_array[i]);
+			block_destroy(block);
+			return (NULL);
+		}
+	}
+
+	if (block->transactions)
+		block->nb_transactions = nb_transactions;
+	return (block);
+}
+
+/**
+ * tx_deserialize_mapped - Loads a transaction from a mapped file
+ * @reader: Pointer to the reader
+ * @tx: Zeroed slot of the transactions array of the Block, to fill
+ * @arena: Arena of the Block, the outputs are allocated from
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int tx_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+						  arena_t *arena)
+{
+	int32_t nb_inputs, nb_outputs;
+
+	tx->mapped = 1;
+	tx->arena = arena;
+	if (hblk_reader_read(reader, tx->id, SHA256_DIGEST_LENGTH) == -1 ||
+		hblk_reader_int32(reader, &nb_inputs) == -1 ||
+		hblk_reader_int32(reader, &nb_outputs) == -1 ||
+		inputs_deserialize_mapped(reader, tx, nb_inputs) == -1 ||
+		outputs_deserialize_mapped(reader, tx, nb_outputs) == -1)
+		return (-1);
+
+	return (0);
+}
+
+/**
+ * inputs_deserialize_mapped - Lists the inputs of a transaction, pointing
+ *							   into the mapped file
+ * @reader: Pointer to the reader
+ * @tx: Transaction whose inputs list is created and filled
+ * @nb_inputs: Number of inputs, -1 if the transaction has no list
+ *
+ * Description: tx_in_t only holds bytes, so the inputs, stored next to
+ * each other in the file, are used in place as the inputs array whatever
+ * its alignment and the endianness of the file.
+ *
+ * Return: 0 if success, -1 otherwise
+*/
+int inputs_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+							  int32_t nb_inputs)
+{
+	int32_t i;
+
+	tx->nb_inputs = -1;
+	if (nb_inputs < 0)
+		return (0);
+
+	if (!(tx->inputs = llist_create(MT_SUPPORT_FALSE)) ||
+		(size_t)nb_inputs > (reader->len - reader->pos) / sizeof(tx_in_t) ||
+		!(tx->input_array = hblk_reader_take(reader,
+											 nb_inputs * sizeof(tx_in_t))))
+		return (-1);
+
+	for (i = 0; i < nb_inputs; i++)
+		if (llist_add_node(tx->inputs, &tx->input_array[i],
+						   ADD_NODE_REAR) == -1)
+			return (-1);
+
+	tx->nb_inputs = nb_inputs;
+	return (0);
+}
+
+/**
+ * outputs_deserialize_mapped - Loads the outputs of a transaction
+ * @reader: Pointer to the reader
+ * @tx: Transaction whose outputs list is created and filled
+ * @nb_outputs: Number of outputs, -1 if the transaction has no list
+ *
+ * Description: Outputs are copied, as the amount of a tx_out_t must be
+ * aligned and stored with the endianness of the system.
+ *
+ * Return: 0 if success, -1 otherwise
+*/
+int outputs_deserialize_mapped(hblk_reader_t *reader, transaction_t *tx,
+							   int32_t nb_outputs)
+{
+	tx_out_t *tx_out;
+	int32_t i;
+
+	tx->nb_outputs = -1;
+	if (nb_outputs < 0)
+		return (0);
+
+	if (!(tx->outputs = llist_create(MT_SUPPORT_FALSE)) ||
+		(size_t)nb_outputs > (reader->len - reader->pos) /
+		(sizeof(int32_t) + EC_PUB_LEN + SHA256_DIGEST_LENGTH) ||
+		(nb_outputs > 0 && !(tx->output_array = arena_alloc(
+			tx->arena, nb_outputs * sizeof(tx_out_t)))))
+		return (-1);
+
+	for (i = 0; i < nb_outputs; i++)
+	{
+		tx_out = &tx->output_array[i];
+		if (hblk_reader_int32(reader, (int32_t *) &tx_out->amount) == -1 ||
+			hblk_reader_read(reader, tx_out->pub, EC_PUB_LEN) == -1 ||
+			hblk_reader_read(reader, tx_out->hash, SHA256_DIGEST_LENGTH) == -1 ||
+			llist_add_node(tx->outputs, tx_out, ADD_NODE_REAR) == -1)
+			return (-1);
+	}
+
+	tx->nb_outputs = nb_outputs;
+	return (0);
+}
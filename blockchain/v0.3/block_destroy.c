@@ -3,11 +3,21 @@
 /**
  * block_destroy - Deletes an existing Block
  * @block: Pointer to block to delete
+ *
+ * A Block allocated from an arena is freed along with the arena, and the
+ * transactions allocated from it.
 */
 void block_destroy(block_t *block)
 {
+	arena_t *arena;
+
 	if (!block)
 		return;
+
+	arena = block->arena;
 	llist_destroy(block->transactions, 1, (node_dtor_t)(transaction_destroy));
-	free(block);
+	merkle_tree_clear(block->merkle);
+	free(block->merkle);
+	arena_free(arena, block);
+	arena_destroy(arena);
 }
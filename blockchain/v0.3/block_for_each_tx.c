@@ -0,0 +1,27 @@
+#include "blockchain.h"
+
+/**
+ * block_for_each_tx - Calls a function for each transaction of a Block,
+ *					   in order, like llist_for_each()
+ * @block: Pointer to the Block
+ * @func: Function called with each transaction_t, its index and arg
+ * @arg: Argument passed to func
+ *
+ * Description: The transactions of a Block loaded from a file are stored
+ * contiguously, and read straight from their array.
+ *
+ * Return: 0 on success, -1 if func returned non-zero or on failure
+*/
+int block_for_each_tx(block_t const *block, node_func_t func, void *arg)
+{
+	int32_t i;
+
+	if (!BLOCK_TX_PACKED(block))
+		return (llist_for_each(block->transactions, func, arg));
+
+	for (i = 0; i < block->nb_transactions; i++)
+		if (func(&block->transaction_array[i], i, arg))
+			return (-1);
+
+	return (0);
+}
@@ -2,6 +2,8 @@
 
 /* Defined at the end of file */
 int add_tx_id_to_bytes_seq(llist_node_t node, unsigned int idx, void *arg);
+int hash_tx_id(llist_node_t node, unsigned int idx, void *arg);
+size_t merkle_header(block_t const *block, int8_t *bytes_seq);
 
 /**
  * block_hash - Computes the hash of a Block
@@ -11,24 +13,66 @@ int add_tx_id_to_bytes_seq(llist_node_t node, unsigned int idx, void *arg);
  *
  * block->hash must be left unchanged.
  *
+ * The sequence described in block_hash_buffer() is fed to the hash field
+ * by field, straight from the Block and its transactions, so it is never
+ * built.
 */
 uint8_t
 *block_hash(block_t const *block, uint8_t hash_buf[SHA256_DIGEST_LENGTH])
 {
-	size_t len;
-	int8_t *bytes_seq, *current_pos;
-	int num_transactions = 0;
+	uint8_t root[SHA256_DIGEST_LENGTH];
+	sha256_ctx_t ctx;
 
 	if (!block || (hash_buf == NULL))
 		return (NULL);
 
 	memset(hash_buf, 0, SHA256_DIGEST_LENGTH);
-	len = sizeof(block->info) + block->data.len;
+	sha256_init(&ctx);
+	sha256_update(&ctx, block, sizeof(block->info) + block->data.len);
+	if (block->version == BLOCK_VERSION_MERKLE)
+	{
+		if (!block_merkle_root(block, root))
+			return (NULL);
+		sha256_update(&ctx, &(block->version), 1);
+		sha256_update(&ctx, root, SHA256_DIGEST_LENGTH);
+	}
+	else if (llist_size(block->transactions) > 0)
+		block_for_each_tx(block, hash_tx_id, &ctx);
+
+	return (sha256_final(&ctx, hash_buf));
+}
+
+/**
+ * block_hash_buffer - Builds the sequence of bytes hashed by block_hash
+ * @block: Pointer to the Block to serialize
+ * @len: Address at which to store the length of the sequence
+ *
+ * Return: Pointer to the allocated sequence, or NULL on failure
+ *
+ * The sequence is the Block info, followed by the Block data,
+ * followed by the id of each transaction of the Block, or for a Merkle
+ * Block by its version and the Merkle root of its transactions
+*/
+int8_t *block_hash_buffer(block_t const *block, size_t *len)
+{
+	int8_t *bytes_seq, *current_pos;
+	int num_transactions = 0;
+
+	if (block->version == BLOCK_VERSION_MERKLE)
+	{
+		bytes_seq = malloc(MERKLE_HEADER_MAX);
+		*len = bytes_seq ? merkle_header(block, bytes_seq) : 0;
+		if (!*len)
+			free(bytes_seq), bytes_seq = NULL;
+		return (bytes_seq);
+	}
+
+	*len = sizeof(block->info) + block->data.len;
 	num_transactions = llist_size(block->transactions);
 	if (num_transactions > 0)
-		len += num_transactions * SHA256_DIGEST_LENGTH;
+		*len += num_transactions * SHA256_DIGEST_LENGTH;
 
-	bytes_seq = malloc(len);
+	bytes_seq = malloc(*len);
 	if (!bytes_seq)
 		return (NULL);
 
@@ -42,16 +86,10 @@ uint8_t
 	{
 		current_pos += sizeof(block->info) + block->data.len;
 		/* We add the transactions ids (hash), not the full transaction */
-		llist_for_each(block->transactions, add_tx_id_to_bytes_seq,
-					   &current_pos);
+		block_for_each_tx(block, add_tx_id_to_bytes_seq, &current_pos);
 	}
 
-	/* Compute hash */
-	sha256((int8_t const *)bytes_seq, len, hash_buf);
-
-	free(bytes_seq);
-
-	return (hash_buf);
+	return (bytes_seq);
 }
 
 /**
@@ -74,3 +112,41 @@ int add_tx_id_to_bytes_seq(llist_node_t node, unsigned int idx, void *arg)
 	idx = idx;
 	return (0);
 }
+
+/**
+ * hash_tx_id - feeds a transaction id (hash) to the hash of its Block
+ * @node: void pointer to transaction_t tx
+ * @idx: index of node (unused)
+ * @arg: void pointer to the SHA-256 context to update
+ *
+ * Return: 0
+*/
+int hash_tx_id(llist_node_t node, unsigned int idx, void *arg)
+{
+	sha256_update(arg, ((transaction_t *) node)->id, SHA256_DIGEST_LENGTH);
+
+	idx = idx;
+	return (0);
+}
+
+/**
+ * merkle_header - Builds the sequence of bytes hashed for a Merkle Block
+ * @block: Pointer to the Merkle Block
+ * @bytes_seq: Buffer of MERKLE_HEADER_MAX bytes receiving the sequence
+ *
+ * Description: The Merkle tree of the Block is brought up to date, only
+ * the transactions added since the last call are hashed.
+ *
+ * Return: Length of the sequence, or 0 on failure
+*/
+size_t merkle_header(block_t const *block, int8_t *bytes_seq)
+{
+	size_t len = sizeof(block->info) + block->data.len;
+
+	memcpy(bytes_seq, block, len);
+	bytes_seq[len++] = block->version;
+	if (!block_merkle_root(block, (uint8_t *)bytes_seq + len))
+		return (0);
+
+	return (len + SHA256_DIGEST_LENGTH);
+}
@@ -0,0 +1,40 @@
+#include "blockchain.h"
+
+/* Defined after */
+int tx_id_mismatch(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * block_hashes_match - Checks the hash of a Block, and the ids of its
+ *						transactions
+ * @block: Block to check
+ *
+ * Return: 1 if every hash matches, 0 otherwise
+*/
+int block_hashes_match(block_t const *block)
+{
+	uint8_t hash[SHA256_DIGEST_LENGTH];
+
+	return (block_hash(block, hash) &&
+			!memcmp(hash, block->hash, SHA256_DIGEST_LENGTH) &&
+			(!block->transactions ||
+			 block_for_each_tx(block, tx_id_mismatch, NULL) == 0));
+}
+
+/**
+ * tx_id_mismatch - Checks whether a transaction id is not the hash of the
+ *					transaction
+ * @node: void pointer to the transaction
+ * @idx: index of the node (unused)
+ * @arg: unused
+ *
+ * Return: 1 if the id does not match, 0 otherwise
+*/
+int tx_id_mismatch(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t const *tx = node;
+	uint8_t id[SHA256_DIGEST_LENGTH];
+
+	return (!transaction_hash(tx, id) ||
+			memcmp(id, tx->id, SHA256_DIGEST_LENGTH) != 0);
+	(void)idx, (void)arg;
+}
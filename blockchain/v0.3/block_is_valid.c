@@ -1,6 +1,13 @@
 #include "blockchain.h"
 
 /* Defined after */
+int block_check(block_t const *block, block_t const *prev_block,
+				llist_t *all_unspent, utxo_index_t const *index,
+				sig_batch_t *batch, spent_set_t *spent);
+/* Defined in transaction/transaction_is_valid.c */
+int transaction_check(transaction_t const *transaction, llist_t *all_unspent,
+					  utxo_index_t const *index, sig_batch_t *batch,
+					  spent_set_t *spent);
 int check_prev_block(block_t const *block, block_t const *prev_block);
 int check_transaction(llist_node_t node, unsigned int idx, void *arg);
 
@@ -29,12 +36,39 @@ int check_transaction(llist_node_t node, unsigned int idx, void *arg);
  * 10. The Block must have at least one transaction, and the first one must be
  *	   a coinbase transaction
  * 11. All transactions must be valid
+ * 12. No two inputs of the Block may spend the same output
+ * 13. The Block version must be known, and not older than the previous
+ *	   Block's one
 */
 int block_is_valid(block_t const *block, block_t const *prev_block,
 				   llist_t *all_unspent)
+{
+	return (block_check(block, prev_block, all_unspent, NULL, NULL, NULL));
+}
+
+/**
+ * block_check - Verifies that a Block is valid, looking up the outputs spent
+ *				 by its transactions in an index if given, or in a list
+ * @block: Pointer to the Block to check
+ * @prev_block: Pointer to the previous Block in the Blockchain,
+ *				or is NULL if block is the first Block of the chain
+ * @all_unspent: pointer to llist_t of all utxos
+ * @index: Hash index of all utxos, or NULL to scan all_unspent
+ * @batch: If not NULL, collects the input signatures instead of verifying
+ *		   them
+ * @spent: Receives the outputs spent by the Block, along with the unspent
+ *		   output each of them refers to, may be NULL if not needed
+ *
+ * Return: 0 if success, -1 otherwise
+*/
+int block_check(block_t const *block, block_t const *prev_block,
+				llist_t *all_unspent, utxo_index_t const *index,
+				sig_batch_t *batch, spent_set_t *spent)
 {
 	uint8_t hash_buf[SHA256_DIGEST_LENGTH];
-	void const *arg[2];
+	spent_set_t block_spent = {0};
+	void const *arg[5];
+	int ret;
 
 	/* 1 & 2 */
 	if (!block || (!prev_block && (block->info.index != 0)))
@@ -44,6 +78,11 @@ int block_is_valid(block_t const *block, block_t const *prev_block,
 	if ((block->info.index == 0) && (memcmp(block, &_genesis, sizeof(block_t))))
 		return (-1);
 
+	/* 13 */
+	if (block->version > BLOCK_VERSION_MAX ||
+		(prev_block && block->version < prev_block->version))
+		return (-1);
+
 	/* 9 */
 	if (hash_matches_difficulty(block->hash, block->info.difficulty) == 0)
 		return (-1);
@@ -64,11 +103,12 @@ int block_is_valid(block_t const *block, block_t const *prev_block,
 	if (llist_size(block->transactions) < 1)
 		return (-1);
 
-	arg[0] = &(block->info.index), arg[1] = all_unspent;
-	if (llist_for_each(block->transactions, check_transaction, arg) == -1)
-		return (-1);
+	arg[0] = &(block->info.index), arg[1] = all_unspent, arg[2] = index;
+	arg[3] = batch, arg[4] = spent ? spent : &block_spent;
+	ret = block_for_each_tx(block, check_transaction, arg);
+	spent_set_clear(&block_spent);
 
-	return (0);
+	return (ret == -1 ? -1 : 0);
 
 }
 
@@ -104,7 +144,10 @@ int check_prev_block(block_t const *block, block_t const *prev_block)
  * check_transaction - check if transaction is valid
  * @node: void pointer to transaction_t tx
  * @idx: index of the node
- * @arg: pointer to utxo_t all_unspent list
+ * @arg: array holding the Block index, the utxo_t all_unspent list
+ *		 its index (NULL to scan the list), the batch collecting
+ *		 the signatures (NULL to verify them) and the set of the outputs
+ *		 spent by the Block
  *
  * Return: 0 if success, -1 otherwise
  *
@@ -117,11 +160,15 @@ int check_transaction(llist_node_t node, unsigned int idx, void *arg)
 	transaction_t *tx = (transaction_t *) node;
 	uint32_t *block_index = (uint32_t *) ptr[0];
 	llist_t *all_unspent = (llist_t *) ptr[1];
+	utxo_index_t *index = (utxo_index_t *) ptr[2];
+	sig_batch_t *batch = (sig_batch_t *) ptr[3];
+	spent_set_t *spent = (spent_set_t *) ptr[4];
 
 	if ((idx == 0) && coinbase_is_valid(tx, *block_index) == 0)
 		return (-1);
 
-	if ((idx > 0) && (transaction_is_valid(tx, all_unspent) == 0))
+	if ((idx > 0) &&
+		transaction_check(tx, all_unspent, index, batch, spent) == 0)
 		return (-1);
 
 	idx = idx;
@@ -0,0 +1,63 @@
+#include "blockchain.h"
+
+/* Defined in block_is_valid.c */
+int block_check(block_t const *block, block_t const *prev_block,
+				llist_t *all_unspent, utxo_index_t const *index,
+				sig_batch_t *batch, spent_set_t *spent);
+
+/**
+ * block_is_valid_indexed - Verifies that a Block is valid, using a hash
+ *							index of the unspent transaction outputs
+ * @block: Pointer to the Block to check
+ * @prev_block: Pointer to the previous Block in the Blockchain,
+ *				or is NULL if block is the first Block of the chain
+ * @index: Hash index of all utxos
+ *
+ * Description: Same checks as block_is_valid(), but the output spent by
+ * each transaction input is found in constant time.
+ *
+ * Return: 0 if success, -1 otherwise
+*/
+int block_is_valid_indexed(block_t const *block, block_t const *prev_block,
+						   utxo_index_t const *index)
+{
+	if (!index)
+		return (-1);
+
+	return (block_check(block, prev_block, NULL, index, NULL, NULL));
+}
+
+/**
+ * block_is_valid_parallel - Verifies that a Block is valid, verifying the
+ *							 signatures of its transactions on several threads
+ * @block: Pointer to the Block to check
+ * @prev_block: Pointer to the previous Block in the Blockchain,
+ *				or is NULL if block is the first Block of the chain
+ * @index: Hash index of all utxos
+ * @nthreads: Number of threads verifying signatures,
+ *			  0 to use every online CPU
+ *
+ * Description: Same checks as block_is_valid_indexed(). Every check but the
+ * signatures is done first, in order, collecting the (public key,
+ * transaction ID, signature) of every input. The signatures are then
+ * verified by ec_verify_parallel(), which stops as soon as one is invalid.
+ * The result does not depend on the number of threads.
+ *
+ * Return: 0 if success, -1 otherwise
+*/
+int block_is_valid_parallel(block_t const *block, block_t const *prev_block,
+							utxo_index_t const *index, unsigned int nthreads)
+{
+	sig_batch_t batch = {0};
+	int ret = -1;
+
+	if (!index)
+		return (-1);
+
+	if (block_check(block, prev_block, NULL, index, &batch, NULL) == 0 &&
+		ec_verify_parallel(batch.items, batch.size, nthreads, NULL) == 1)
+		ret = 0;
+
+	free(batch.items);
+	return (ret);
+}
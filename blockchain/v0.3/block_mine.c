@@ -5,15 +5,34 @@
  * @block: Pointer to the Block to be mined
  *
  * The function must find a hash for block that matches its difficulty
+ *
+ * The Block is serialized once by block_miner_init(), so that each attempt
+ * only patches the nonce and hashes the bytes following the midstate.
+ * Several nonces are tried at once when a multi-buffer SHA-256 engine is
+ * available, the nonce found stays the lowest matching one.
+ * If it can't be serialized, every attempt goes through block_hash().
+ * The Merkle tree of the Block is brought up to date first.
 */
 void block_mine(block_t *block)
 {
+	block_miner_t miner;
 
 	if (!block)
 		return;
 
-	do {
-		block_hash(block, block->hash);
-	} while ((hash_matches_difficulty(block->hash, block->info.difficulty) == 0)
-			 && ++block->info.nonce);
+	block_merkle_sync(block);
+	if (block_miner_init(&miner, block) == -1)
+	{
+		do {
+			block_hash(block, block->hash);
+		} while ((hash_matches_difficulty(block->hash,
+										  block->info.difficulty) == 0)
+				 && ++block->info.nonce);
+		return;
+	}
+
+	block_miner_search(&miner, block->info.nonce,
+					   UINT64_MAX - block->info.nonce, block->info.difficulty,
+					   &(block->info.nonce), block->hash);
+	block_miner_destroy(&miner);
 }
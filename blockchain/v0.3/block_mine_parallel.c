@@ -0,0 +1,168 @@
+#include "blockchain.h"
+
+/* Defined after */
+void *mine_nonce_range(void *arg);
+int mining_is_done(mining_ctx_t *ctx);
+void mining_publish(mining_ctx_t *ctx, uint64_t nonce,
+					uint8_t const hash[SHA256_DIGEST_LENGTH]);
+unsigned int start_workers(mining_worker_t *workers, unsigned int nthreads,
+						   mining_ctx_t *ctx);
+
+/**
+ * block_mine_parallel - Mines a Block using several threads
+ * @block: Pointer to the Block to be mined
+ * @nthreads: Number of mining threads, 0 to use every online CPU
+ *
+ * Description: The nonce space starting at block->info.nonce is split into
+ * nthreads disjoint ranges, one per thread. The first thread finding a hash
+ * that matches the Block's difficulty publishes its nonce, and all the other
+ * threads stop. The Block's nonce and hash are then updated, so the result
+ * is a valid Block, exactly as if block_mine() had been used.
+ *
+ * The Merkle tree of the Block is brought up to date before the threads
+ * are started, so they only read the Block.
+ *
+ * If only one thread is requested, or if no thread could be started,
+ * the Block is mined by block_mine() in the calling thread.
+*/
+void block_mine_parallel(block_t *block, unsigned int nthreads)
+{
+	mining_ctx_t ctx;
+	mining_worker_t *workers;
+	unsigned int i, started;
+
+	if (!block)
+		return;
+
+	block_merkle_sync(block);
+	if (nthreads == 0)
+		nthreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+	workers = nthreads > 1 ? calloc(nthreads, sizeof(*workers)) : NULL;
+	if (!workers)
+	{
+		block_mine(block);
+		return;
+	}
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.block = block;
+	pthread_mutex_init(&ctx.lock, NULL);
+	started = start_workers(workers, nthreads, &ctx);
+	for (i = 0; i < started; i++)
+		pthread_join(workers[i].thread, NULL);
+
+	if (ctx.found)
+	{
+		block->info.nonce = ctx.nonce;
+		memcpy(block->hash, ctx.hash, SHA256_DIGEST_LENGTH);
+	}
+	else
+		block_mine(block);
+
+	pthread_mutex_destroy(&ctx.lock);
+	free(workers);
+}
+
+/**
+ * start_workers - Splits the nonce space and starts one thread per range
+ * @workers: Array of nthreads workers to fill in
+ * @nthreads: Number of threads to start
+ * @ctx: State shared by all the workers
+ *
+ * Return: Number of threads actually started
+*/
+unsigned int start_workers(mining_worker_t *workers, unsigned int nthreads,
+						   mining_ctx_t *ctx)
+{
+	uint64_t span = UINT64_MAX / nthreads;
+	unsigned int i;
+
+	for (i = 0; i < nthreads; i++)
+	{
+		workers[i].ctx = ctx;
+		workers[i].first = ctx->block->info.nonce + i * span;
+		workers[i].count = span;
+		/* The last range takes the remainder of the division */
+		if (i == nthreads - 1)
+			workers[i].count = UINT64_MAX - i * span;
+
+		if (pthread_create(&(workers[i].thread), NULL, mine_nonce_range,
+						   &(workers[i])) != 0)
+			break;
+	}
+
+	return (i);
+}
+
+/**
+ * mine_nonce_range - Thread routine, looks for a valid nonce in a range
+ * @arg: Pointer to the mining_worker_t describing the range
+ *
+ * Each thread serializes its own copy of the Block, the transactions list
+ * is shared and only read.
+ *
+ * Return: NULL
+*/
+void *mine_nonce_range(void *arg)
+{
+	mining_worker_t *worker = arg;
+	mining_ctx_t *ctx = worker->ctx;
+	block_miner_t miner;
+	uint8_t hash[SHA256_DIGEST_LENGTH];
+	uint64_t i, chunk, nonce;
+
+	if (block_miner_init(&miner, ctx->block) == -1)
+		return (NULL);
+
+	for (i = 0; i < worker->count && !mining_is_done(ctx); i += chunk)
+	{
+		chunk = worker->count - i;
+		if (chunk > MINING_CHECK_INTERVAL)
+			chunk = MINING_CHECK_INTERVAL;
+		if (block_miner_search(&miner, worker->first + i, chunk,
+							   ctx->block->info.difficulty, &nonce, hash))
+		{
+			mining_publish(ctx, nonce, hash);
+			break;
+		}
+	}
+
+	block_miner_destroy(&miner);
+	return (NULL);
+}
+
+/**
+ * mining_is_done - Checks whether a thread already found a valid nonce
+ * @ctx: State shared by all the workers
+ *
+ * Return: 1 if a valid nonce was found, 0 otherwise
+*/
+int mining_is_done(mining_ctx_t *ctx)
+{
+	int found;
+
+	pthread_mutex_lock(&ctx->lock);
+	found = ctx->found;
+	pthread_mutex_unlock(&ctx->lock);
+
+	return (found);
+}
+
+/**
+ * mining_publish - Stores a valid nonce, unless another thread was faster
+ * @ctx: State shared by all the workers
+ * @nonce: Nonce found
+ * @hash: Hash of the Block using nonce
+*/
+void mining_publish(mining_ctx_t *ctx, uint64_t nonce,
+					uint8_t const hash[SHA256_DIGEST_LENGTH])
+{
+	pthread_mutex_lock(&ctx->lock);
+	if (!ctx->found)
+	{
+		ctx->found = 1;
+		ctx->nonce = nonce;
+		memcpy(ctx->hash, hash, SHA256_DIGEST_LENGTH);
+	}
+	pthread_mutex_unlock(&ctx->lock);
+}
@@ -0,0 +1,160 @@
+#include "blockchain.h"
+
+/* Defined after */
+unsigned int block_miner_hash_lanes(block_miner_t *miner, uint64_t first,
+									uint8_t (*hashes)[SHA256_DIGEST_LENGTH]);
+
+/**
+ * block_miner_init - Prepares a Block to be hashed for many nonces
+ * @miner: Pointer to the miner structure to initialize
+ * @block: Pointer to the Block to be mined
+ *
+ * Return: 0 on success, -1 on failure
+ *
+ * The Block is serialized once, exactly as block_hash() does. Only the
+ * nonce changes between two attempts, so the SHA-256 state of every 64-byte
+ * chunk located before the nonce is computed once and kept as a midstate.
+ *
+ * If the multi-buffer SHA-256 engine hashes several messages at once,
+ * one copy of the serialized Block is made per lane.
+*/
+int block_miner_init(block_miner_t *miner, block_t const *block)
+{
+	unsigned int l;
+
+	if (!miner || !block)
+		return (-1);
+
+	memset(miner, 0, sizeof(*miner));
+	miner->buf = block_hash_buffer(block, &(miner->len));
+	if (!miner->buf)
+		return (-1);
+
+	miner->tail = (MINER_NONCE_OFFSET / SHA256_CBLOCK) * SHA256_CBLOCK;
+	sha256_init(&(miner->midstate));
+	sha256_update(&(miner->midstate), miner->buf, miner->tail);
+
+	miner->lanes = sha256_mb_lanes();
+	if (miner->lanes > 1)
+		miner->lane_buf = malloc(miner->lanes * miner->len);
+	if (!miner->lane_buf)
+		miner->lanes = 1;
+	for (l = 0; l < miner->lanes && miner->lane_buf; l++)
+		memcpy(miner->lane_buf + l * miner->len, miner->buf, miner->len);
+
+	return (0);
+}
+
+/**
+ * block_miner_hash - Computes the hash of the Block for a given nonce
+ * @miner: Pointer to the initialized miner structure
+ * @nonce: Nonce to try
+ * @hash_buf: Buffer that will store the hash
+ *
+ * Return: Pointer to hash_buf, or NULL on failure
+ *
+ * Only the bytes following the midstate are hashed, and no memory
+ * is allocated
+*/
+uint8_t *block_miner_hash(block_miner_t *miner, uint64_t nonce,
+						  uint8_t hash_buf[SHA256_DIGEST_LENGTH])
+{
+	sha256_ctx_t ctx;
+
+	if (!miner || !miner->buf || hash_buf == NULL)
+		return (NULL);
+
+	memcpy(miner->buf + MINER_NONCE_OFFSET, &nonce, sizeof(nonce));
+
+	ctx = miner->midstate;
+	sha256_update(&ctx, miner->buf + miner->tail, miner->len - miner->tail);
+	return (sha256_final(&ctx, hash_buf));
+}
+
+/**
+ * block_miner_hash_lanes - Computes the hashes of the Block for
+ *							consecutive nonces, one per lane
+ * @miner: Pointer to the initialized miner structure
+ * @first: Nonce of the first lane
+ * @hashes: Array of miner->lanes buffers that will store the hashes
+ *
+ * Return: Number of nonces tried
+*/
+unsigned int block_miner_hash_lanes(block_miner_t *miner, uint64_t first,
+									uint8_t (*hashes)[SHA256_DIGEST_LENGTH])
+{
+	int8_t const *msgs[SHA256_MB_MAX_LANES];
+	uint64_t nonce;
+	unsigned int l;
+
+	if (miner->lanes < 2)
+	{
+		block_miner_hash(miner, first, hashes[0]);
+		return (1);
+	}
+
+	for (l = 0; l < miner->lanes; l++)
+	{
+		nonce = first + l;
+		msgs[l] = miner->lane_buf + l * miner->len;
+		memcpy((int8_t *)msgs[l] + MINER_NONCE_OFFSET, &nonce, sizeof(nonce));
+	}
+	sha256_mb(msgs, miner->len, miner->lanes, hashes);
+
+	return (miner->lanes);
+}
+
+/**
+ * block_miner_search - Looks for the first nonce of a range giving a hash
+ *						that matches a difficulty
+ * @miner: Pointer to the initialized miner structure
+ * @first: First nonce of the range
+ * @count: Number of nonces in the range
+ * @difficulty: Difficulty the hash must match
+ * @nonce: Address at which to store the nonce found
+ * @hash_buf: Buffer that will store the hash of the nonce found
+ *
+ * Nonces are tried in increasing order, so the nonce found is the same
+ * whatever the number of lanes of the SHA-256 engine.
+ *
+ * Return: 1 if a nonce was found, 0 otherwise
+*/
+int block_miner_search(block_miner_t *miner, uint64_t first, uint64_t count,
+					   uint32_t difficulty, uint64_t *nonce,
+					   uint8_t hash_buf[SHA256_DIGEST_LENGTH])
+{
+	uint8_t hashes[SHA256_MB_MAX_LANES][SHA256_DIGEST_LENGTH];
+	uint64_t done;
+	unsigned int l, nb;
+
+	for (done = 0; done < count; done += nb)
+	{
+		nb = block_miner_hash_lanes(miner, first + done, hashes);
+		for (l = 0; l < nb && done + l < count; l++)
+		{
+			if (hash_matches_difficulty(hashes[l], difficulty))
+			{
+				*nonce = first + done + l;
+				memcpy(hash_buf, hashes[l], SHA256_DIGEST_LENGTH);
+				return (1);
+			}
+		}
+	}
+
+	return (0);
+}
+
+/**
+ * block_miner_destroy - Releases the memory held by a miner structure
+ * @miner: Pointer to the miner structure
+*/
+void block_miner_destroy(block_miner_t *miner)
+{
+	if (!miner)
+		return;
+
+	free(miner->buf);
+	free(miner->lane_buf);
+	miner->buf = NULL;
+	miner->lane_buf = NULL;
+}
@@ -10,6 +10,11 @@
 #include "../../crypto/hblk_crypto.h"
 #include "./provided/endianness.h"
 #include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "transaction.h"
 
 #define HBLK_MAGIC "HBLK"
@@ -17,6 +22,8 @@
 
 #define HBLK_VERSION "0.3"
 #define LEN_VERSION 3
+/* Version of the files holding a version byte after the hash of each Block */
+#define HBLK_VERSION_MERKLE "0.4"
 
 #define HBLK_ENDIAN _get_endianness()
 
@@ -25,20 +32,149 @@
 /* Defines how often (in Blocks) the difficulty should be adjusted */
 #define DIFFICULTY_ADJUSTMENT_INTERVAL 5
 
+/* Defines how often (in hashes) a mining thread checks if it must stop */
+#define MINING_CHECK_INTERVAL 1024
+
+/* Size of the buffer used to write a Blockchain file */
+#define HBLK_WRITER_BUFSIZE (1 << 20)
+/* Appended to the path of a Blockchain file while it is being written */
+#define HBLK_WRITER_TMP_SUFFIX ".tmp"
+
+/* Block offsets index, stored next to a Blockchain file */
+#define HBLK_INDEX_SUFFIX ".idx"
+#define HIDX_MAGIC "HIDX"
+/* Magic, version, endianness, size of the indexed file, number of Blocks */
+#define HIDX_HEADER_LEN (LEN_MAGIC + LEN_VERSION + 1 + 8 + 4)
+
+/* Append-only log of the Blocks saved after a Blockchain file */
+#define CHAIN_LOG_SUFFIX ".log"
+#define CHAIN_LOG_MAGIC "HBLL"
+/* Number of Blocks logged after a snapshot before a new one is written */
+#define CHAIN_LOG_COMPACT_INTERVAL 64
+
+/* Commitment to the unspent outputs of a Blockchain file, stored next to it */
+#define UTXO_SNAPSHOT_SUFFIX ".utxo"
+#define UTXO_SNAPSHOT_MAGIC "HUTX"
+/* Magic, version, endianness, size of the file, number of Blocks, tip hash */
+#define UTXO_SNAPSHOT_HEADER_LEN (LEN_MAGIC + LEN_VERSION + 1 + 8 + 4 + \
+	SHA256_DIGEST_LENGTH)
+
+/* Status of a background check of the unspent outputs */
+#define UTXO_CHECK_RUNNING 0
+#define UTXO_CHECK_PASSED 1
+#define UTXO_CHECK_FAILED -1
+
+/* Number of Blocks a loading thread claims at once */
+#define BLOCK_LOADER_CHUNK 16
+
+/* Transactions are committed to by the list of their IDs */
+#define BLOCK_VERSION_LIST 0
+/* Transactions are committed to by the root of a Merkle tree of their IDs */
+#define BLOCK_VERSION_MERKLE 1
+/* Latest Block version */
+#define BLOCK_VERSION_MAX BLOCK_VERSION_MERKLE
+
+/* Maximum number of levels of a Merkle tree, leaves included */
+#define MERKLE_MAX_LEVELS 32
+/* Minimum number of hashes allocated for a level of a Merkle tree */
+#define MERKLE_MIN_CAPACITY 8
+/* Byte prefixed to two hashes hashed into their parent */
+#define MERKLE_NODE_PREFIX 0x01
+/* Size of the sequence of bytes hashed by block_hash() for a Merkle Block */
+#define MERKLE_HEADER_MAX (sizeof(block_info_t) + BLOCKCHAIN_DATA_MAX + 1 + \
+	SHA256_DIGEST_LENGTH)
+
+/* Number of tables the transactions of a chain index are spread over */
+#define TX_INDEX_SHARDS 16
+/* Table of a chain index holding the transaction of a given ID */
+#define TX_INDEX_SHARD(tx_id) ((tx_id)[0] & (TX_INDEX_SHARDS - 1))
+
+/**
+ * struct tx_location_s - Transaction of a chain, and where it is
+ *
+ * @tx:     Pointer to the transaction, NULL for an empty slot
+ * @height: Height of the Block holding @tx
+ * @pos:    Position of @tx in the transactions of the Block
+ */
+typedef struct tx_location_s
+{
+	struct transaction_s *tx;
+	uint32_t height;
+	uint32_t pos;
+} tx_location_t;
+
+/**
+ * struct chain_index_s - Index of the Blocks of a chain, by height and by
+ *                        hash
+ *
+ * @blocks:          Array of the @nb_blocks indexed Blocks, by height
+ * @blocks_capacity: Number of Blocks @blocks can hold
+ * @nb_blocks:       Number of indexed Blocks
+ * @hashes:          Table of block_t pointers, by hash
+ * @tx_shards:       Tables of tx_location_t, by transaction ID, holding the
+ *                   transactions of the indexed Blocks, each in the table
+ *                   TX_INDEX_SHARD() of its ID
+ */
+typedef struct chain_index_s
+{
+	struct block_s **blocks;
+	size_t blocks_capacity;
+	size_t nb_blocks;
+	probe_table_t hashes;
+	probe_table_t tx_shards[TX_INDEX_SHARDS];
+} chain_index_t;
+
+/* How to read the slots of the tables of a chain_index_t */
+extern probe_ops_t const chain_index_ops;
+extern probe_ops_t const tx_index_ops;
+
 
 
 /**
  * struct blockchain_s - Blockchain structure
  *
- * @chain:   Linked list of Blocks
- * @unspent: Linked list of unspent transaction outputs
+ * @chain:         Linked list of Blocks
+ * @unspent:       Linked list of unspent transaction outputs
+ * @unspent_index: Hash index of @unspent, must be kept in sync by updating
+ *                 @unspent with update_unspent_indexed()
+ * @map:           File the Blockchain was loaded from, mapped in memory by
+ *                 blockchain_deserialize_mapped(), or NULL
+ * @map_len:       Size of @map in bytes
+ * @chain_index:   Index of @chain by height, by hash, and of its
+ *                 transactions by ID, caught up with the Blocks appended
+ *                 to @chain by each lookup, or NULL
  */
 typedef struct blockchain_s
 {
 	llist_t *chain;
 	llist_t *unspent;
+	utxo_index_t *unspent_index;
+	uint8_t *map;
+	size_t map_len;
+	chain_index_t *chain_index;
 } blockchain_t;
 
+/**
+ * struct merkle_tree_s - Merkle tree of the transaction IDs of a Block
+ *
+ * Description: Level 0 holds the IDs, each other level the hashes of the
+ * pairs of nodes of the level below, of MERKLE_NODE_PREFIX followed by
+ * both nodes. The last node of a level with an odd number of nodes is
+ * moved up as is. The root is the only node of level @depth.
+ *
+ * @levels:     Nodes of each level, SHA256_DIGEST_LENGTH bytes each
+ * @sizes:      Number of nodes of each level
+ * @capacities: Number of nodes allocated for each level
+ * @depth:      Level of the root
+ */
+typedef struct merkle_tree_s
+{
+	uint8_t *levels[MERKLE_MAX_LEVELS];
+	uint32_t sizes[MERKLE_MAX_LEVELS];
+	uint32_t capacities[MERKLE_MAX_LEVELS];
+	uint32_t depth;
+} merkle_tree_t;
+
 /**
  * struct block_info_s - Block info structure
  *
@@ -88,6 +224,16 @@ typedef struct block_data_s
  * @data:         Block data
  * @transactions: List of transactions
  * @hash:         256-bit digest of the Block, to ensure authenticity
+ * @arena:        Arena the Block and its transactions are allocated from,
+ *                freed with the Block, or NULL if the Block is allocated
+ *                on its own
+ * @transaction_array: Contiguous array @transactions points into, or NULL
+ * @nb_transactions:   Number of transactions in @transaction_array
+ * @version:      BLOCK_VERSION_LIST or BLOCK_VERSION_MERKLE
+ * @merkle:       Merkle tree of the transaction IDs, brought up to date by
+ *                block_merkle_sync() as transactions are added, or NULL if
+ *                the Block has none. The tree is rebuilt whenever it is
+ *                needed and this one is missing or out of date
  */
 typedef struct block_s
 {
@@ -95,8 +241,306 @@ typedef struct block_s
 	block_data_t data; /* This must stay second */
 	llist_t *transactions;
 	uint8_t hash[SHA256_DIGEST_LENGTH];
+	arena_t *arena;
+	transaction_t *transaction_array;
+	int32_t nb_transactions;
+	uint8_t version;
+	merkle_tree_t *merkle;
 } block_t;
 
+/* 1 if the transactions of a Block are read from its transaction array */
+#define BLOCK_TX_PACKED(block) records_packed((block)->transactions, \
+	(block)->transaction_array, (block)->nb_transactions, \
+	sizeof(transaction_t))
+
+/* Bytes allocated from an arena for a transaction with 1 input, 2 outputs */
+#define BLOCK_ARENA_TX_SIZE (ARENA_ROUND(sizeof(transaction_t)) + \
+	ARENA_ROUND(sizeof(tx_in_t)) + 2 * ARENA_ROUND(sizeof(tx_out_t)))
+/* Bytes first reserved in the arena of a Block with nb transactions */
+#define BLOCK_ARENA_SIZE(nb) (ARENA_ROUND(sizeof(block_t)) + \
+	(nb) * BLOCK_ARENA_TX_SIZE)
+
+/* Offset of the nonce in the sequence of bytes hashed by block_hash() */
+#define MINER_NONCE_OFFSET offsetof(block_info_t, nonce)
+
+/**
+ * struct block_miner_s - Block serialized once, ready to be hashed for
+ *                        many nonces
+ *
+ * @buf:      Sequence of bytes hashed by block_hash()
+ * @len:      Size of @buf in bytes
+ * @tail:     Offset in @buf of the first byte not absorbed in @midstate
+ * @midstate: SHA-256 state after every 64-byte chunk preceding the nonce
+ * @lanes:    Number of nonces tried at once by the multi-buffer engine
+ * @lane_buf: @lanes consecutive copies of @buf, one per nonce tried at once,
+ *            or NULL if nonces are tried one by one
+ */
+typedef struct block_miner_s
+{
+	int8_t *buf;
+	size_t len;
+	size_t tail;
+	sha256_ctx_t midstate;
+	unsigned int lanes;
+	int8_t *lane_buf;
+} block_miner_t;
+
+/**
+ * struct mining_ctx_s - State shared by the threads of a parallel miner
+ *
+ * @block: Block being mined, only read by the workers
+ * @lock:  Protects @found, @nonce and @hash
+ * @found: Set to 1 by the first worker finding a matching hash
+ * @nonce: Winning nonce
+ * @hash:  Hash of the Block using the winning nonce
+ */
+typedef struct mining_ctx_s
+{
+	block_t const *block;
+	pthread_mutex_t lock;
+	int found;
+	uint64_t nonce;
+	uint8_t hash[SHA256_DIGEST_LENGTH];
+} mining_ctx_t;
+
+/**
+ * struct mining_worker_s - Nonce range handed to a mining thread
+ *
+ * @thread: Thread identifier
+ * @ctx:    State shared by all the workers
+ * @first:  First nonce of the range
+ * @count:  Number of nonces in the range
+ */
+typedef struct mining_worker_s
+{
+	pthread_t thread;
+	mining_ctx_t *ctx;
+	uint64_t first;
+	uint64_t count;
+} mining_worker_t;
+
+/**
+ * struct hblk_writer_s - Buffered output stream of a Blockchain file
+ *
+ * @path:    Path of the file, replaced once the writer is closed
+ * @tmp:     Path of the file actually written, in the same buffer as @path,
+ *           or NULL if the file is written in place
+ * @fd:      File descriptor written
+ * @buf:     Bytes not written to @file yet
+ * @len:     Number of bytes in @buf
+ * @written: Total number of bytes written so far, buffered or not
+ * @error:   Set to 1 once a write failed, every later write then fails
+ * @offsets: If not NULL, receives the offset of each Block written,
+ *           followed by the offset of the unspent outputs
+ * @versioned: 1 if the version of each Block is written, as in the
+ *             HBLK_VERSION_MERKLE format
+ */
+typedef struct hblk_writer_s
+{
+	char *path;
+	char *tmp;
+	int fd;
+	uint8_t *buf;
+	size_t len;
+	size_t written;
+	int error;
+	uint64_t *offsets;
+	int versioned;
+} hblk_writer_t;
+
+/**
+ * struct hblk_reader_s - Cursor over a Blockchain file mapped in memory
+ *
+ * @base:   First byte of the mapping
+ * @len:    Size of the mapping in bytes
+ * @pos:    Offset of the next byte to read
+ * @endian: Endianness of the file, read from its header
+ * @versioned: 1 if the version of each Block is read, as in the
+ *             HBLK_VERSION_MERKLE format
+ */
+typedef struct hblk_reader_s
+{
+	uint8_t *base;
+	size_t len;
+	size_t pos;
+	uint8_t endian;
+	int versioned;
+} hblk_reader_t;
+
+/**
+ * struct chain_log_s - Log of the Blocks appended to a Blockchain file
+ *
+ * Description: The log starts with a header identifying the snapshot it
+ * follows: magic, version, endianness, size of the snapshot, number of
+ * Blocks in it and hash of its last Block. Each record then holds the
+ * size of a serialized Block, followed by the Block, in the format of
+ * blockchain_serialize().
+ *
+ * @reader:          Reader over the log, positioned after the last valid
+ *                   record read
+ * @snapshot_size:   Size of the Blockchain file the log follows
+ * @snapshot_blocks: Number of Blocks in that file
+ * @nb_records:      Number of valid records read so far
+ * @last_hash:       Hash of the last Block of the file, then of the last
+ *                   valid record read
+ */
+typedef struct chain_log_s
+{
+	hblk_reader_t reader;
+	uint64_t snapshot_size;
+	int32_t snapshot_blocks;
+	uint32_t nb_records;
+	uint8_t last_hash[SHA256_DIGEST_LENGTH];
+} chain_log_t;
+
+/**
+ * struct block_loader_s - State shared by the threads loading the Blocks
+ *                         of a mapped file
+ *
+ * @reader:    Reader over the whole file, only its fields are read
+ * @offsets:   Offset of each Block, then of the unspent outputs
+ * @blocks:    Array receiving the Blocks, in order
+ * @nb_blocks: Number of Blocks
+ * @lock:      Protects @next and @failed
+ * @next:      First Block not claimed by a thread yet
+ * @failed:    Set to 1 once a Block could not be loaded or checked
+ */
+typedef struct block_loader_s
+{
+	hblk_reader_t const *reader;
+	uint64_t const *offsets;
+	block_t **blocks;
+	int32_t nb_blocks;
+	pthread_mutex_t lock;
+	int32_t next;
+	int failed;
+} block_loader_t;
+
+/**
+ * struct tx_indexer_s - Transactions a thread adds to a chain index
+ *
+ * @index:    Chain index to update
+ * @height:   Height of the Block being visited
+ * @thread:   Number of the thread, it only fills the tables whose number
+ *            modulo @nthreads is @thread
+ * @nthreads: Number of threads filling the tables
+ * @counts:   Number of transactions counted for each table
+ * @failed:   Set to 1 once a table could not be grown
+ */
+typedef struct tx_indexer_s
+{
+	chain_index_t *index;
+	uint32_t height;
+	unsigned int thread;
+	unsigned int nthreads;
+	size_t counts[TX_INDEX_SHARDS];
+	int failed;
+} tx_indexer_t;
+
+/**
+ * struct utxo_snapshot_s - Commitment to the unspent outputs of a
+ *                          Blockchain file
+ *
+ * Description: Stored in path.utxo by blockchain_serialize(), it is only
+ * trusted for the file of the same size, ending with the same Block.
+ *
+ * @file_size:  Size of the Blockchain file
+ * @nb_blocks:  Number of Blocks in the file
+ * @tip:        Hash of the last Block of the file
+ * @nb_unspent: Number of unspent outputs in the file
+ * @commitment: utxo_commitment() of the unspent outputs of the file
+ */
+typedef struct utxo_snapshot_s
+{
+	uint64_t file_size;
+	int32_t nb_blocks;
+	uint8_t tip[SHA256_DIGEST_LENGTH];
+	int32_t nb_unspent;
+	uint8_t commitment[SHA256_DIGEST_LENGTH];
+} utxo_snapshot_t;
+
+/**
+ * struct utxo_verifier_s - Background replay of a Blockchain, checking its
+ *                          unspent outputs
+ *
+ * @thread:    Thread replaying the Blocks
+ * @blocks:    Blocks to replay, in order, only read by @thread
+ * @nb_blocks: Number of Blocks
+ * @expected:  utxo_commitment() of the unspent outputs, taken when the
+ *             check was started
+ * @lock:      Protects @status
+ * @status:    UTXO_CHECK_RUNNING, UTXO_CHECK_PASSED or UTXO_CHECK_FAILED
+ */
+typedef struct utxo_verifier_s
+{
+	pthread_t thread;
+	block_t **blocks;
+	int32_t nb_blocks;
+	uint8_t expected[SHA256_DIGEST_LENGTH];
+	pthread_mutex_t lock;
+	int status;
+} utxo_verifier_t;
+
+/**
+ * struct mempool_entry_s - Pending transaction of a mempool
+ *
+ * @tx:   Transaction, owned by the mempool
+ * @prev: Entry added before this one, or NULL
+ * @next: Entry added after this one, or NULL
+ */
+typedef struct mempool_entry_s
+{
+	transaction_t *tx;
+	struct mempool_entry_s *prev;
+	struct mempool_entry_s *next;
+} mempool_entry_t;
+
+/**
+ * struct mempool_outpoint_s - Output spent by a pending transaction
+ *
+ * @in:    Input spending the output, NULL for an empty slot
+ * @entry: Entry of the transaction holding @in, or MEMPOOL_TOMBSTONE
+ *         if the transaction was removed
+ */
+typedef struct mempool_outpoint_s
+{
+	tx_in_t const *in;
+	mempool_entry_t *entry;
+} mempool_outpoint_t;
+
+/**
+ * struct mempool_s - Transactions waiting to be mined
+ *
+ * Description: The entries are linked in the order they were added, which
+ * is the order they are mined in. Two hash tables, see probe_table_t, find
+ * an entry by transaction ID, and the entry spending an output, keyed like
+ * utxo_index_t. An output can only be spent by one pending transaction, so
+ * double spends are rejected when they are added.
+ *
+ * @ids:       Table of mempool_entry_t pointers, by transaction ID, a
+ *             removed entry leaving MEMPOOL_TOMBSTONE in its slot
+ * @outpoints: Table of the mempool_outpoint_t spent by the entries
+ * @head:      Oldest entry, or NULL if the mempool is empty
+ * @tail:      Newest entry, or NULL if the mempool is empty
+ * @size:      Number of entries
+ */
+typedef struct mempool_s
+{
+	probe_table_t ids;
+	probe_table_t outpoints;
+	mempool_entry_t *head;
+	mempool_entry_t *tail;
+	size_t size;
+} mempool_t;
+
+/* Marks a slot whose entry was removed from a mempool */
+extern mempool_entry_t mempool_tombstone;
+#define MEMPOOL_TOMBSTONE (&mempool_tombstone)
+
+/* How to read the slots of the tables of a mempool_t */
+extern probe_ops_t const mempool_ids_ops;
+extern probe_ops_t const mempool_outpoints_ops;
+
 /* Used in other files, comes from provided/_genesis.c */
 extern block_t const _genesis;
 
@@ -112,18 +556,245 @@ void blockchain_destroy(blockchain_t *blockchain);
 uint8_t *block_hash(block_t const *block,
 				    uint8_t hash_buf[SHA256_DIGEST_LENGTH]);
 
+int8_t *block_hash_buffer(block_t const *block, size_t *len);
+
 int blockchain_serialize(blockchain_t const *blockchain, char const *path);
 
+int blockchain_serialize_stream(blockchain_t const *blockchain,
+								hblk_writer_t *writer);
+
+int hblk_writer_open(hblk_writer_t *writer, char const *path);
+
+int hblk_writer_append(hblk_writer_t *writer, char const *path);
+
+int hblk_writer_write(hblk_writer_t *writer, void const *data, size_t len);
+
+int hblk_writer_flush(hblk_writer_t *writer);
+
+int hblk_writer_sync(hblk_writer_t *writer);
+
+int hblk_writer_close(hblk_writer_t *writer);
+
 blockchain_t *blockchain_deserialize(char const *path);
 
+blockchain_t *blockchain_deserialize_mapped(char const *path);
+
+block_t *block_deserialize_mapped(hblk_reader_t *reader);
+
+int hblk_reader_open(hblk_reader_t *reader, char const *path);
+
+void *hblk_reader_take(hblk_reader_t *reader, size_t len);
+
+int hblk_reader_read(hblk_reader_t *reader, void *dest, size_t len);
+
+int hblk_reader_int32(hblk_reader_t *reader, int32_t *value);
+
+int hblk_reader_uint64(hblk_reader_t *reader, uint64_t *value);
+
+int blockchain_index_write(char const *path, uint64_t const *offsets,
+						   int32_t nb_blocks, uint64_t file_size);
+
+uint64_t *blockchain_index_read(char const *path, uint64_t file_size,
+								int32_t *nb_blocks);
+
+blockchain_t *blockchain_deserialize_parallel(char const *path,
+											  unsigned int nthreads);
+
+block_t *blockchain_read_block(char const *path, uint32_t index);
+
+char *hblk_path_suffix(char const *path, char const *suffix);
+
+int block_hashes_match(block_t const *block);
+
+int block_own_inputs(block_t *block);
+
+int block_for_each_tx(block_t const *block, node_func_t func, void *arg);
+
+size_t block_serialized_size(block_t const *block, int versioned);
+
+int chain_log_create(char const *path, blockchain_t const *blockchain,
+					 uint64_t snapshot_size);
+
+int chain_log_open(chain_log_t *log, char const *path,
+				   uint64_t snapshot_size);
+
+block_t *chain_log_next(chain_log_t *log);
+
+void chain_log_close(chain_log_t *log);
+
+int blockchain_save_incremental(blockchain_t const *blockchain,
+								char const *path, size_t *written);
+
+blockchain_t *blockchain_load(char const *path, unsigned int nthreads);
+
+int utxo_snapshot_write(char const *path, blockchain_t const *blockchain,
+						uint64_t file_size);
+
+int utxo_snapshot_read(char const *path, uint64_t file_size,
+					   utxo_snapshot_t *snapshot);
+
+int blockchain_check_unspent(blockchain_t *blockchain, char const *path);
+
+block_t **blockchain_blocks(blockchain_t const *blockchain,
+							int32_t *nb_blocks);
+
+llist_t *unspent_replay(block_t *const *blocks, int32_t nb_blocks,
+						utxo_index_t **index);
+
+int blockchain_rebuild_unspent(blockchain_t *blockchain);
+
+utxo_verifier_t *utxo_verifier_start(blockchain_t const *blockchain);
+
+int utxo_verifier_status(utxo_verifier_t *verifier);
+
+void utxo_verifier_destroy(utxo_verifier_t *verifier);
+
 int block_is_valid(block_t const *block, block_t const *prev_block,
 				   llist_t *all_unspent);
 
+int block_is_valid_indexed(block_t const *block, block_t const *prev_block,
+						   utxo_index_t const *index);
+
+int block_is_valid_parallel(block_t const *block, block_t const *prev_block,
+							utxo_index_t const *index, unsigned int nthreads);
+
+int block_apply(blockchain_t *blockchain, block_t *block,
+				unsigned int nthreads);
+
 int hash_matches_difficulty(uint8_t const hash[SHA256_DIGEST_LENGTH],
 							uint32_t difficulty);
 
 void block_mine(block_t *block);
 
+void block_mine_parallel(block_t *block, unsigned int nthreads);
+
+int block_miner_init(block_miner_t *miner, block_t const *block);
+
+uint8_t *block_miner_hash(block_miner_t *miner, uint64_t nonce,
+						  uint8_t hash_buf[SHA256_DIGEST_LENGTH]);
+
+int block_miner_search(block_miner_t *miner, uint64_t first, uint64_t count,
+					   uint32_t difficulty, uint64_t *nonce,
+					   uint8_t hash_buf[SHA256_DIGEST_LENGTH]);
+
+void block_miner_destroy(block_miner_t *miner);
+
 uint32_t blockchain_difficulty(blockchain_t const *blockchain);
 
+chain_index_t *chain_index_create(llist_t *chain, unsigned int nthreads);
+
+void chain_index_destroy(chain_index_t *index);
+
+int chain_index_add_block(chain_index_t *index, block_t *block);
+
+int chain_index_add(chain_index_t *index, block_t *block);
+
+int tx_index_build(chain_index_t *index, unsigned int nthreads);
+
+int count_tx(llist_node_t node, unsigned int idx, void *arg);
+
+int insert_tx(llist_node_t node, unsigned int idx, void *arg);
+
+int chain_index_sync(chain_index_t *index, llist_t *chain);
+
+size_t chain_index_hash(uint8_t const hash[SHA256_DIGEST_LENGTH]);
+
+int block_slot_is(void const *slot, void const *key);
+
+size_t tx_index_hash(uint8_t const *tx_id);
+
+int tx_location_is(void const *slot, void const *key);
+
+block_t *blockchain_get_block_at(blockchain_t const *blockchain,
+								 uint32_t index);
+
+block_t *blockchain_get_block_by_hash(blockchain_t const *blockchain,
+									  uint8_t const *hash);
+
+transaction_t *blockchain_get_tx(blockchain_t const *blockchain,
+								 uint8_t const *tx_id, uint32_t *height,
+								 uint32_t *pos);
+
+int blockchain_input_is_anchored(blockchain_t const *blockchain,
+								 tx_in_t const *in);
+
+int block_set_version(block_t *block, uint8_t version);
+
+uint8_t *block_merkle_root(block_t const *block,
+						   uint8_t root[SHA256_DIGEST_LENGTH]);
+
+merkle_tree_t const *block_merkle_tree(block_t const *block,
+									   merkle_tree_t *tmp);
+
+int block_merkle_sync(block_t *block);
+
+int merkle_tree_sync(merkle_tree_t *tree, block_t const *block);
+
+int merkle_tree_matches(merkle_tree_t const *tree, block_t const *block);
+
+int merkle_tree_push(merkle_tree_t *tree, uint8_t const *hash);
+
+int merkle_tree_update(merkle_tree_t *tree, uint32_t first);
+
+uint8_t *merkle_tree_root(merkle_tree_t const *tree,
+						  uint8_t root[SHA256_DIGEST_LENGTH]);
+
+void merkle_tree_clear(merkle_tree_t *tree);
+
+uint8_t *merkle_hash_pair(uint8_t const *left, uint8_t const *right,
+						  uint8_t parent[SHA256_DIGEST_LENGTH]);
+
+uint8_t *block_merkle_proof(block_t const *block, uint32_t pos,
+							uint32_t *len);
+
+int merkle_proof_verify(uint8_t const root[SHA256_DIGEST_LENGTH],
+						uint8_t const *tx_id, uint32_t pos,
+						uint32_t nb_leaves, uint8_t const *proof,
+						uint32_t len);
+
+int hblk_reader_version(hblk_reader_t *reader, uint8_t const *version);
+
+int blockchain_is_legacy(blockchain_t const *blockchain, uint32_t first);
+
+mempool_t *mempool_create(void);
+
+void mempool_destroy(mempool_t *pool);
+
+int mempool_add(mempool_t *pool, transaction_t *tx,
+				utxo_index_t const *index);
+
+transaction_t *mempool_remove(mempool_t *pool, mempool_entry_t *entry);
+
+mempool_entry_t *mempool_find(mempool_t const *pool, uint8_t const *tx_id);
+
+mempool_entry_t *mempool_spender(mempool_t const *pool, tx_in_t const *in);
+
+size_t mempool_id_slot(mempool_t const *pool, uint8_t const *tx_id);
+
+size_t mempool_outpoint_slot(mempool_t const *pool, tx_in_t const *in);
+
+int mempool_entry_is(void const *slot, void const *key);
+
+int mempool_outpoint_is(void const *slot, void const *key);
+
+int mempool_reserve(mempool_t *pool, size_t nb_outpoints);
+
+int mempool_index_input(llist_node_t node, unsigned int idx, void *arg);
+
+int mempool_unindex_input(llist_node_t node, unsigned int idx, void *arg);
+
+int mempool_template(mempool_t *pool, block_t *block, size_t max);
+
+int mempool_remove_block(mempool_t *pool, block_t const *block);
+
+int mempool_revalidate(mempool_t *pool, utxo_index_t const *index);
+
+transaction_t *mempool_transaction_create(mempool_t const *pool,
+										  EC_KEY const *sender,
+										  EC_KEY const *receiver,
+										  uint32_t amount,
+										  utxo_index_t const *index);
+
+int mempool_spends(mempool_t const *pool, utxo_t const *utxo);
+
 #endif /* BLOCKCHAIN_H */
@@ -21,7 +21,11 @@ blockchain_t *blockchain_create(void)
 
 	new_bchain->chain = llist_create(MT_SUPPORT_FALSE);
 	new_bchain->unspent = llist_create(MT_SUPPORT_FALSE);
-	if (!new_bchain->chain || !new_bchain->unspent)
+	new_bchain->unspent_index = utxo_index_create(NULL);
+	new_bchain->map = NULL, new_bchain->map_len = 0;
+	new_bchain->chain_index = NULL;
+	if (!new_bchain->chain || !new_bchain->unspent ||
+		!new_bchain->unspent_index)
 	{
 		free(new_bchain);
 		return (NULL);
@@ -41,5 +45,12 @@ blockchain_t *blockchain_create(void)
 		return (NULL);
 	}
 
+	new_bchain->chain_index = chain_index_create(new_bchain->chain, 1);
+	if (!new_bchain->chain_index)
+	{
+		blockchain_destroy(new_bchain);
+		return (NULL);
+	}
+
 	return (new_bchain);
 }
@@ -1,8 +1,9 @@
 #include "blockchain.h"
 
 /* Defined after */
-int header_deserialize(FILE *file, uint8_t *file_endian);
-block_t *block_deserialize(FILE *file, const uint8_t file_endian);
+int header_deserialize(FILE *file, uint8_t *file_endian, int *versioned);
+block_t *block_deserialize(FILE *file, const uint8_t file_endian,
+						   int versioned);
 transaction_t *tx_deserialize(FILE *file, const uint8_t file_endian);
 int inputs_outputs_deserialize(FILE *file, const uint8_t file_endian,
 							   transaction_t *tx, const int32_t nb_inputs,
@@ -22,6 +23,7 @@ blockchain_t *blockchain_deserialize(char const *path)
 {
 	FILE *file = fopen(path, "rb");
 	uint8_t file_endian;
+	int versioned;
 	blockchain_t *blockchain = calloc(1, sizeof(blockchain_t));
 	int32_t nb_blocks = 0, nb_unspent = 0, i;
 
@@ -35,7 +37,7 @@ blockchain_t *blockchain_deserialize(char const *path)
 	blockchain->chain = llist_create(MT_SUPPORT_FALSE);
 	blockchain->unspent = llist_create(MT_SUPPORT_FALSE);
 	if (!blockchain->chain || !blockchain->unspent ||
-		header_deserialize(file, &file_endian) == -1)
+		header_deserialize(file, &file_endian, &versioned) == -1)
 	{
 		fclose(file);
 		blockchain_destroy(blockchain);
@@ -49,7 +51,7 @@ blockchain_t *blockchain_deserialize(char const *path)
 
 	for (i = 0; i < nb_blocks; i++)
 	{
-		block_t *block = block_deserialize(file, file_endian);
+		block_t *block = block_deserialize(file, file_endian, versioned);
 
 		if (!block)
 		{
@@ -80,6 +82,14 @@ blockchain_t *blockchain_deserialize(char const *path)
 		llist_add_node(blockchain->unspent, utxo, ADD_NODE_REAR);
 	}
 	fclose(file);
+
+	blockchain->unspent_index = utxo_index_create(blockchain->unspent);
+	blockchain->chain_index = chain_index_create(blockchain->chain, 1);
+	if (!blockchain->unspent_index || !blockchain->chain_index)
+	{
+		blockchain_destroy(blockchain);
+		return (NULL);
+	}
 	return (blockchain);
 }
 
@@ -87,9 +97,10 @@ blockchain_t *blockchain_deserialize(char const *path)
  * header_deserialize - Deserializes blockchain header from file
  * @file: file to read
  * @file_endian: pointer to short int to update with the file's endianness
+ * @versioned: pointer set to 1 if the Blocks of the file hold their version
  * Return: 0 upon success, or -1 upon failure
 */
-int header_deserialize(FILE *file, uint8_t *file_endian)
+int header_deserialize(FILE *file, uint8_t *file_endian, int *versioned)
 {
 	char f_magic[LEN_MAGIC];
 	char f_version[LEN_VERSION];
@@ -101,8 +112,9 @@ int header_deserialize(FILE *file, uint8_t *file_endian)
 	fread(f_version, LEN_VERSION, 1, file);
 	fread(file_endian, sizeof(*file_endian), 1, file);
 
+	*versioned = !strncmp(HBLK_VERSION_MERKLE, f_version, LEN_VERSION);
 	if ((strncmp(HBLK_MAGIC, f_magic, LEN_MAGIC) != 0) ||
-		(strncmp(HBLK_VERSION, f_version, LEN_VERSION) != 0))
+		(!*versioned && strncmp(HBLK_VERSION, f_version, LEN_VERSION) != 0))
 	{
 		printf("Error header file\n");
 		return (-1);
@@ -114,9 +126,11 @@ int header_deserialize(FILE *file, uint8_t *file_endian)
  * block_deserialize - Deserializes a block from a file
  * @file: file to read
  * @file_endian: pointer to short int to update with the file's endianness
+ * @versioned: 1 if the version of the Block follows its hash
  * Return: Pointer to block deserialized or NULL on failure
 */
-block_t *block_deserialize(FILE *file, const uint8_t file_endian)
+block_t *block_deserialize(FILE *file, const uint8_t file_endian,
+						   int versioned)
 {
 	block_t *block = calloc(1, sizeof(block_t));
 	int32_t nb_transactions = 0, i;
@@ -133,6 +147,8 @@ block_t *block_deserialize(FILE *file, const uint8_t file_endian)
 
 	fread(&(block->data.buffer), block->data.len, 1, file);
 	fread(&(block->hash), SHA256_DIGEST_LENGTH, 1, file);
+	if (versioned)
+		fread(&(block->version), sizeof(block->version), 1, file);
 
 	fread(&nb_transactions, sizeof(nb_transactions), 1, file);
 	if (file_endian != HBLK_ENDIAN)
@@ -0,0 +1,139 @@
+#include "blockchain.h"
+
+/* Defined after */
+int header_deserialize_mapped(hblk_reader_t *reader, int32_t *nb_blocks,
+							  int32_t *nb_unspent);
+int unspent_deserialize_mapped(hblk_reader_t *reader, llist_t *unspent,
+							   int32_t nb_unspent);
+
+/**
+ * blockchain_deserialize_mapped - Loads a Blockchain from a file mapped in
+ *								   memory
+ * @path: path contains the path to a file to load the Blockchain from
+ *
+ * Description: Same as blockchain_deserialize(), but the file is parsed in
+ * place instead of being read field by field. The transaction inputs,
+ * which make up most of a file, are not copied: they point into the
+ * mapping, which lives as long as the Blockchain. Their pages are only
+ * read from the file when they are used, and copied by the kernel if
+ * they are written to.
+ *
+ * Return: Pointer to the deserialized Blockchain upon success,
+ *		   or NULL upon failure
+*/
+blockchain_t *blockchain_deserialize_mapped(char const *path)
+{
+	hblk_reader_t reader;
+	blockchain_t *blockchain;
+	block_t *block;
+	int32_t nb_blocks, nb_unspent, i;
+
+	if (hblk_reader_open(&reader, path) == -1)
+		return (NULL);
+	blockchain = calloc(1, sizeof(*blockchain));
+	if (!blockchain)
+	{
+		munmap(reader.base, reader.len);
+		return (NULL);
+	}
+	blockchain->map = reader.base, blockchain->map_len = reader.len;
+
+	blockchain->chain = llist_create(MT_SUPPORT_FALSE);
+	blockchain->unspent = llist_create(MT_SUPPORT_FALSE);
+	if (!blockchain->chain || !blockchain->unspent ||
+		header_deserialize_mapped(&reader, &nb_blocks, &nb_unspent) == -1)
+	{
+		blockchain_destroy(blockchain);
+		return (NULL);
+	}
+
+	for (i = 0; i < nb_blocks; i++)
+	{
+		block = block_deserialize_mapped(&reader);
+		if (!block ||
+			llist_add_node(blockchain->chain, block, ADD_NODE_REAR) == -1)
+		{
+			block_destroy(block);
+			blockchain_destroy(blockchain);
+			return (NULL);
+		}
+	}
+
+	if (unspent_deserialize_mapped(&reader, blockchain->unspent,
+								   nb_unspent) == -1 ||
+		!(blockchain->unspent_index = utxo_index_create(blockchain->unspent)) ||
+		!(blockchain->chain_index = chain_index_create(blockchain->chain, 1)))
+	{
+		blockchain_destroy(blockchain);
+		return (NULL);
+	}
+	return (blockchain);
+}
+
+/**
+ * header_deserialize_mapped - Checks the header of a mapped file
+ * @reader: Pointer to the reader, its endianness and format are set
+ * @nb_blocks: Pointer receiving the number of Blocks
+ * @nb_unspent: Pointer receiving the number of unspent outputs
+ *
+ * Return: 0 upon success, or -1 upon failure
+*/
+int header_deserialize_mapped(hblk_reader_t *reader, int32_t *nb_blocks,
+							  int32_t *nb_unspent)
+{
+	uint8_t const *magic = hblk_reader_take(reader, LEN_MAGIC);
+	uint8_t const *version = hblk_reader_take(reader, LEN_VERSION);
+
+	if (!magic || !version ||
+		hblk_reader_read(reader, &reader->endian, 1) == -1 ||
+		memcmp(magic, HBLK_MAGIC, LEN_MAGIC) != 0 ||
+		hblk_reader_version(reader, version) == -1)
+	{
+		printf("Error header file\n");
+		return (-1);
+	}
+
+	if (hblk_reader_int32(reader, nb_blocks) == -1 ||
+		hblk_reader_int32(reader, nb_unspent) == -1)
+		return (-1);
+
+	return (0);
+}
+
+/**
+ * unspent_deserialize_mapped - Loads the unspent outputs of a mapped file
+ * @reader: Pointer to the reader
+ * @unspent: List receiving the unspent outputs
+ * @nb_unspent: Number of unspent outputs
+ *
+ * Description: Unspent outputs are copied, they are freed one by one as
+ * they get spent.
+ *
+ * Return: 0 upon success, or -1 upon failure
+*/
+int unspent_deserialize_mapped(hblk_reader_t *reader, llist_t *unspent,
+							   int32_t nb_unspent)
+{
+	utxo_t *utxo;
+	int32_t i;
+
+	for (i = 0; i < nb_unspent; i++)
+	{
+		utxo = calloc(1, sizeof(*utxo));
+		if (!utxo ||
+			hblk_reader_read(reader, utxo->block_hash,
+							 SHA256_DIGEST_LENGTH) == -1 ||
+			hblk_reader_read(reader, utxo->tx_id, SHA256_DIGEST_LENGTH) == -1 ||
+			hblk_reader_int32(reader, (int32_t *) &utxo->out.amount) == -1 ||
+			hblk_reader_read(reader, utxo->out.pub, EC_PUB_LEN) == -1 ||
+			hblk_reader_read(reader, utxo->out.hash,
+							 SHA256_DIGEST_LENGTH) == -1 ||
+			llist_add_node(unspent, utxo, ADD_NODE_REAR) == -1)
+		{
+			free(utxo);
+			return (-1);
+		}
+	}
+
+	return (0);
+}
@@ -0,0 +1,232 @@
+#include "blockchain.h"
+
+/* Defined in blockchain_deserialize_mapped.c */
+int header_deserialize_mapped(hblk_reader_t *reader, int32_t *nb_blocks,
+							  int32_t *nb_unspent);
+int unspent_deserialize_mapped(hblk_reader_t *reader, llist_t *unspent,
+							   int32_t nb_unspent);
+/* Defined after */
+int load_blocks(blockchain_t *blockchain, hblk_reader_t const *reader,
+				uint64_t const *offsets, int32_t nb_blocks,
+				unsigned int nthreads);
+void *load_block_range(void *arg);
+block_t *load_block(block_loader_t *loader, int32_t i);
+blockchain_t *load_unindexed(char const *path);
+
+/**
+ * blockchain_deserialize_parallel - Loads a Blockchain from a file mapped
+ *									 in memory, on several threads
+ * @path: path contains the path to a file to load the Blockchain from
+ * @nthreads: Number of threads, 0 to use every online CPU
+ *
+ * Description: The offset of each Block is read from the index written
+ * next to the file by blockchain_serialize(), so the Blocks are parsed
+ * and their hashes checked at the same time on nthreads threads.
+ *
+ * Without a usable index, or if the Blocks do not lie at the offsets it
+ * gives, as when it was left behind by an older file of the same size,
+ * the file is loaded by load_unindexed().
+ *
+ * Return: Pointer to the deserialized Blockchain upon success,
+ *		   or NULL upon failure, or if a Block was tampered with
+*/
+blockchain_t *blockchain_deserialize_parallel(char const *path,
+											  unsigned int nthreads)
+{
+	hblk_reader_t reader;
+	blockchain_t *blockchain;
+	uint64_t *offsets = NULL;
+	int32_t nb_blocks, nb_unspent, nb_indexed;
+
+	if (hblk_reader_open(&reader, path) == -1)
+		return (NULL);
+	blockchain = calloc(1, sizeof(*blockchain));
+	if (blockchain)
+		offsets = blockchain_index_read(path, reader.len, &nb_indexed);
+	if (!offsets)
+	{
+		free(blockchain);
+		munmap(reader.base, reader.len);
+		return (blockchain_deserialize_mapped(path));
+	}
+	blockchain->map = reader.base, blockchain->map_len = reader.len;
+
+	blockchain->chain = llist_create(MT_SUPPORT_FALSE);
+	blockchain->unspent = llist_create(MT_SUPPORT_FALSE);
+	if (!blockchain->chain || !blockchain->unspent ||
+		header_deserialize_mapped(&reader, &nb_blocks, &nb_unspent) == -1 ||
+		nb_blocks != nb_indexed || offsets[0] != reader.pos ||
+		load_blocks(blockchain, &reader, offsets, nb_blocks, nthreads) == -1)
+	{
+		free(offsets);
+		blockchain_destroy(blockchain);
+		return (load_unindexed(path));
+	}
+
+	reader.pos = offsets[nb_blocks];
+	free(offsets);
+	if (unspent_deserialize_mapped(&reader, blockchain->unspent,
+								   nb_unspent) == -1 ||
+		!(blockchain->unspent_index = utxo_index_create(blockchain->unspent)) ||
+		!(blockchain->chain_index = chain_index_create(blockchain->chain,
+														  nthreads)))
+	{
+		blockchain_destroy(blockchain);
+		return (NULL);
+	}
+	return (blockchain);
+}
+
+/**
+ * load_blocks - Loads the Blocks of a mapped file on several threads,
+ *				 and appends them to the chain in order
+ * @blockchain: Blockchain receiving the Blocks
+ * @reader: Reader over the whole file
+ * @offsets: Offset of each Block, then of the unspent outputs
+ * @nb_blocks: Number of Blocks
+ * @nthreads: Number of threads, 0 to use every online CPU
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int load_blocks(blockchain_t *blockchain, hblk_reader_t const *reader,
+				uint64_t const *offsets, int32_t nb_blocks,
+				unsigned int nthreads)
+{
+	block_loader_t loader;
+	pthread_t *threads;
+	unsigned int i, started = 0;
+	int32_t b;
+
+	memset(&loader, 0, sizeof(loader));
+	loader.reader = reader, loader.offsets = offsets;
+	loader.nb_blocks = nb_blocks;
+	loader.blocks = calloc(nb_blocks + 1, sizeof(*loader.blocks));
+	if (nthreads == 0)
+		nthreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+	threads = nthreads > 1 ? calloc(nthreads - 1, sizeof(*threads)) : NULL;
+	if (!loader.blocks)
+	{
+		free(threads);
+		return (-1);
+	}
+
+	pthread_mutex_init(&loader.lock, NULL);
+	/* The calling thread is a worker too */
+	for (i = 0; threads && i < nthreads - 1; i++, started++)
+		if (pthread_create(&threads[i], NULL, load_block_range, &loader) != 0)
+			break;
+	load_block_range(&loader);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+	pthread_mutex_destroy(&loader.lock);
+
+	for (b = 0; b < nb_blocks; b++)
+	{
+		/* Each Block must follow the previous one */
+		if (loader.failed || (b && memcmp(loader.blocks[b]->info.prev_hash,
+				loader.blocks[b - 1]->hash, SHA256_DIGEST_LENGTH)) ||
+			llist_add_node(blockchain->chain, loader.blocks[b],
+						   ADD_NODE_REAR) == -1)
+			loader.failed = 1, block_destroy(loader.blocks[b]);
+	}
+
+	free(loader.blocks), free(threads);
+	return (loader.failed ? -1 : 0);
+}
+
+/**
+ * load_block_range - Thread routine, loads chunks of Blocks until every
+ *					  Block is claimed
+ * @arg: Pointer to the block_loader_t shared by the threads
+ *
+ * Return: NULL
+*/
+void *load_block_range(void *arg)
+{
+	block_loader_t *loader = arg;
+	int32_t first, last, i;
+
+	while (1)
+	{
+		pthread_mutex_lock(&loader->lock);
+		first = loader->failed ? loader->nb_blocks : loader->next;
+		last = first + BLOCK_LOADER_CHUNK;
+		if (last > loader->nb_blocks)
+			last = loader->nb_blocks;
+		loader->next = last;
+		pthread_mutex_unlock(&loader->lock);
+		if (first >= last)
+			return (NULL);
+
+		for (i = first; i < last; i++)
+		{
+			loader->blocks[i] = load_block(loader, i);
+			if (!loader->blocks[i])
+			{
+				pthread_mutex_lock(&loader->lock);
+				loader->failed = 1;
+				pthread_mutex_unlock(&loader->lock);
+			}
+		}
+	}
+}
+
+/**
+ * load_block - Loads a Block, and checks its hash and the ids of its
+ *				transactions
+ * @loader: State shared by the threads
+ * @i: Index of the Block
+ *
+ * Return: Pointer to the Block, or NULL if it could not be loaded, does not
+ *		   end where the next Block starts or does not match its hashes
+*/
+block_t *load_block(block_loader_t *loader, int32_t i)
+{
+	hblk_reader_t reader = *loader->reader;
+	block_t *block;
+
+	reader.pos = loader->offsets[i];
+	block = block_deserialize_mapped(&reader);
+	if (!block)
+		return (NULL);
+
+	if (reader.pos != loader->offsets[i + 1] || !block_hashes_match(block))
+	{
+		block_destroy(block);
+		return (NULL);
+	}
+
+	return (block);
+}
+
+/**
+ * load_unindexed - Loads a Blockchain file without its index, and checks
+ *					the hashes of its Blocks
+ * @path: Path of the Blockchain file
+ *
+ * Description: A Block found not to match its hashes at an offset of the
+ * index was either tampered with, or the index is stale. The file is
+ * loaded again by blockchain_deserialize_mapped() and each Block checked,
+ * so that only a stale index lets it load.
+ *
+ * Return: Pointer to the Blockchain, or NULL on failure or if a Block does
+ *		   not match its hashes
+*/
+blockchain_t *load_unindexed(char const *path)
+{
+	blockchain_t *blockchain = blockchain_deserialize_mapped(path);
+	block_t const *block;
+	uint32_t i;
+
+	for (i = 0; blockchain &&
+		 (block = blockchain_get_block_at(blockchain, i)); i++)
+	{
+		if (!block_hashes_match(block))
+		{
+			blockchain_destroy(blockchain);
+			return (NULL);
+		}
+	}
+
+	return (blockchain);
+}
@@ -12,5 +12,10 @@ void blockchain_destroy(blockchain_t *blockchain)
 
 	llist_destroy(blockchain->chain, 1, (node_dtor_t) block_destroy);
 	llist_destroy(blockchain->unspent, 1, NULL);
+	utxo_index_destroy(blockchain->unspent_index);
+	chain_index_destroy(blockchain->chain_index);
+	/* Unmapped last, the inputs of the Blocks pointed into it */
+	if (blockchain->map)
+		munmap(blockchain->map, blockchain->map_len);
 	free(blockchain);
 }
@@ -47,8 +47,7 @@ uint32_t blockchain_difficulty(blockchain_t const *blockchain)
 	/* Now difficulty must be adjusted */
 	size = llist_size(blockchain->chain);
 	last_adjust_index = size - DIFFICULTY_ADJUSTMENT_INTERVAL;
-	last_adjust_block = (block_t *) llist_get_node_at(blockchain->chain,
-													  last_adjust_index);
+	last_adjust_block = blockchain_get_block_at(blockchain, last_adjust_index);
 	if (!last_adjust_block)
 		return (0);
 
@@ -0,0 +1,123 @@
+#include "blockchain.h"
+
+/**
+ * blockchain_index_write - Writes the Block offsets index of a Blockchain
+ *							file
+ * @path: Path of the Blockchain file, the index is written to path.idx
+ * @offsets: Offset of each Block, then of the unspent outputs,
+ *			 or NULL to remove the index
+ * @nb_blocks: Number of Blocks
+ * @file_size: Size of the Blockchain file, so that an index left behind by
+ *			   an older version of the file is detected
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int blockchain_index_write(char const *path, uint64_t const *offsets,
+						   int32_t nb_blocks, uint64_t file_size)
+{
+	char *idx_path = hblk_path_suffix(path, HBLK_INDEX_SUFFIX);
+	hblk_writer_t writer;
+	uint8_t endian = HBLK_ENDIAN;
+	int32_t i;
+	int ret;
+
+	if (!idx_path)
+		return (-1);
+	if (!offsets || hblk_writer_open(&writer, idx_path) == -1)
+	{
+		remove(idx_path);
+		free(idx_path);
+		return (offsets ? -1 : 0);
+	}
+
+	hblk_writer_write(&writer, HIDX_MAGIC, LEN_MAGIC);
+	hblk_writer_write(&writer, HBLK_VERSION, LEN_VERSION);
+	hblk_writer_write(&writer, &endian, sizeof(endian));
+	hblk_writer_write(&writer, &file_size, sizeof(file_size));
+	hblk_writer_write(&writer, &nb_blocks, sizeof(nb_blocks));
+	for (i = 0; i <= nb_blocks; i++)
+		hblk_writer_write(&writer, &offsets[i], sizeof(*offsets));
+	ret = hblk_writer_close(&writer);
+
+	free(idx_path);
+	return (ret);
+}
+
+/**
+ * blockchain_index_read - Reads the Block offsets index of a Blockchain file
+ * @path: Path of the Blockchain file, the index is read from path.idx
+ * @file_size: Size of the Blockchain file
+ * @nb_blocks: Pointer receiving the number of Blocks
+ *
+ * Description: The offsets are checked to be increasing, and to lie
+ * within the Blockchain file. The index is discarded if it was written
+ * for a file of another size.
+ *
+ * Return: Array of the offset of each Block, followed by the offset of the
+ *		   unspent outputs, or NULL if there is no usable index
+*/
+uint64_t *blockchain_index_read(char const *path, uint64_t file_size,
+								int32_t *nb_blocks)
+{
+	char *idx_path = hblk_path_suffix(path, HBLK_INDEX_SUFFIX);
+	hblk_reader_t reader;
+	uint64_t *offsets = NULL, indexed_size;
+	int32_t i;
+	int ok;
+
+	if (!idx_path || hblk_reader_open(&reader, idx_path) == -1)
+	{
+		free(idx_path);
+		return (NULL);
+	}
+	free(idx_path);
+
+	reader.endian = reader.len > LEN_MAGIC + LEN_VERSION ?
+					reader.base[LEN_MAGIC + LEN_VERSION] : 0;
+	ok = reader.len >= HIDX_HEADER_LEN &&
+		 !memcmp(reader.base, HIDX_MAGIC, LEN_MAGIC) &&
+		 !memcmp(reader.base + LEN_MAGIC, HBLK_VERSION, LEN_VERSION) &&
+		 hblk_reader_take(&reader, LEN_MAGIC + LEN_VERSION + 1) &&
+		 hblk_reader_uint64(&reader, &indexed_size) == 0 &&
+		 indexed_size == file_size &&
+		 hblk_reader_int32(&reader, nb_blocks) == 0 && *nb_blocks >= 0 &&
+		 (uint64_t)*nb_blocks + 1 <= (reader.len - HIDX_HEADER_LEN) / 8;
+	if (ok)
+		offsets = malloc((*nb_blocks + 1) * sizeof(*offsets));
+	for (i = 0; offsets && i <= *nb_blocks; i++)
+	{
+		hblk_reader_uint64(&reader, &offsets[i]);
+		if (offsets[i] > file_size || (i && offsets[i] <= offsets[i - 1]))
+		{
+			free(offsets);
+			offsets = NULL;
+		}
+	}
+
+	munmap(reader.base, reader.len);
+	return (offsets);
+}
+
+/**
+ * hblk_path_suffix - Builds the path of a file stored next to a Blockchain
+ *					  file
+ * @path: Path of the Blockchain file
+ * @suffix: Suffix appended to path
+ *
+ * Return: Allocated path, or NULL on failure
+*/
+char *hblk_path_suffix(char const *path, char const *suffix)
+{
+	char *new_path;
+
+	if (!path || !suffix)
+		return (NULL);
+
+	new_path = malloc(strlen(path) + strlen(suffix) + 1);
+	if (!new_path)
+		return (NULL);
+
+	strcpy(new_path, path);
+	strcat(new_path, suffix);
+	return (new_path);
+}
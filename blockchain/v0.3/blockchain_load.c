@@ -0,0 +1,82 @@
+#include "blockchain.h"
+
+/* Defined after */
+int replay_block(blockchain_t *blockchain, block_t *block);
+
+/**
+ * blockchain_load - Loads a Blockchain saved by blockchain_save_incremental()
+ * @path: Path of the Blockchain file
+ * @nthreads: Number of threads loading the Blocks of the file,
+ *			  0 to use every online CPU
+ *
+ * Description: The file is loaded by blockchain_deserialize_parallel(),
+ * its unspent outputs are checked against the commitment written next to
+ * it, and only rebuilt from its Blocks if they don't match. Each valid
+ * record of its log is then appended, and its transactions applied to the
+ * unspent outputs. A log written after another version of the file is
+ * ignored, so is a damaged last record.
+ *
+ * Return: Pointer to the Blockchain upon success, or NULL upon failure
+*/
+blockchain_t *blockchain_load(char const *path, unsigned int nthreads)
+{
+	blockchain_t *blockchain = blockchain_deserialize_parallel(path, nthreads);
+	block_t *block, *last;
+	chain_log_t log;
+
+	if (blockchain && blockchain_check_unspent(blockchain, path) == -1)
+	{
+		blockchain_destroy(blockchain);
+		return (NULL);
+	}
+	if (!blockchain || chain_log_open(&log, path, blockchain->map_len) == -1)
+		return (blockchain);
+
+	last = llist_get_tail(blockchain->chain);
+	if (log.snapshot_blocks == llist_size(blockchain->chain) && last &&
+		!memcmp(last->hash, log.last_hash, SHA256_DIGEST_LENGTH))
+	{
+		while ((block = chain_log_next(&log)))
+		{
+			if (replay_block(blockchain, block) == -1)
+			{
+				chain_log_close(&log);
+				blockchain_destroy(blockchain);
+				return (NULL);
+			}
+		}
+	}
+
+	chain_log_close(&log);
+	return (blockchain);
+}
+
+/**
+ * replay_block - Appends a logged Block to a Blockchain, and applies its
+ *				  transactions to the unspent outputs
+ * @blockchain: Pointer to the Blockchain
+ * @block: Block read from the log, destroyed on failure
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int replay_block(blockchain_t *blockchain, block_t *block)
+{
+	llist_t *unspent;
+
+	if (llist_add_node(blockchain->chain, block, ADD_NODE_REAR) == -1)
+	{
+		block_destroy(block);
+		return (-1);
+	}
+	if (chain_index_add(blockchain->chain_index, block) == -1)
+		return (-1);
+
+	unspent = update_unspent_indexed(block->transactions, block->hash,
+									 blockchain->unspent,
+									 blockchain->unspent_index);
+	if (!unspent)
+		return (-1);
+
+	blockchain->unspent = unspent;
+	return (0);
+}
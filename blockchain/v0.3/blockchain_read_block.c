@@ -0,0 +1,81 @@
+#include "blockchain.h"
+
+/* Defined after */
+int tx_own_inputs(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * blockchain_read_block - Loads a single Block from a Blockchain file
+ * @path: Path of the Blockchain file
+ * @index: Index of the Block in the chain
+ *
+ * Description: The offset of the Block is read from the index written
+ * next to the file by blockchain_serialize(), only that Block is parsed.
+ *
+ * Return: Pointer to the Block, owning all its memory, or NULL if the file
+ *		   has no usable index, has fewer Blocks, or on failure
+*/
+block_t *blockchain_read_block(char const *path, uint32_t index)
+{
+	hblk_reader_t reader;
+	uint64_t *offsets = NULL;
+	block_t *block = NULL;
+	int32_t nb_blocks;
+
+	if (hblk_reader_open(&reader, path) == -1)
+		return (NULL);
+	/* The endianness of the Blockchain file follows its magic and version */
+	if (reader.len > LEN_MAGIC + LEN_VERSION &&
+		!memcmp(reader.base, HBLK_MAGIC, LEN_MAGIC) &&
+		hblk_reader_version(&reader, reader.base + LEN_MAGIC) == 0)
+	{
+		reader.endian = reader.base[LEN_MAGIC + LEN_VERSION];
+		offsets = blockchain_index_read(path, reader.len, &nb_blocks);
+	}
+
+	if (offsets && index < (uint32_t)nb_blocks)
+	{
+		reader.pos = offsets[index];
+		block = block_deserialize_mapped(&reader);
+		if (block && (reader.pos != offsets[index + 1] ||
+					  block_own_inputs(block) == -1))
+		{
+			block_destroy(block);
+			block = NULL;
+		}
+	}
+
+	free(offsets);
+	munmap(reader.base, reader.len);
+	return (block);
+}
+
+/**
+ * block_own_inputs - Copies the inputs of a Block's transactions out of
+ *					  the mapped file
+ * @block: Block loaded by block_deserialize_mapped()
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int block_own_inputs(block_t *block)
+{
+	if (!block->transactions)
+		return (0);
+
+	return (block_for_each_tx(block, tx_own_inputs, NULL));
+}
+
+/**
+ * tx_own_inputs - Replaces the mapped inputs of a transaction with a packed
+ *				   copy, allocated from the arena of the transaction if it
+ *				   has one
+ * @node: void pointer to the transaction
+ * @idx: index of the node (unused)
+ * @arg: unused
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int tx_own_inputs(llist_node_t node, unsigned int idx, void *arg)
+{
+	return (transaction_pack(node));
+	(void)idx, (void)arg;
+}
@@ -0,0 +1,155 @@
+#include "blockchain.h"
+
+/* Defined in blockchain_serialize.c */
+int block_serialize(llist_node_t node, unsigned int idx, void *arg);
+/* Defined after */
+int blockchain_compact(blockchain_t const *blockchain, char const *path,
+					   size_t *written);
+int chain_log_append(blockchain_t const *blockchain, char const *path,
+					 int32_t nb_logged, int versioned, size_t *written);
+int append_block(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * blockchain_save_incremental - Saves a Blockchain, writing only the Blocks
+ *								 added since the last save
+ * @blockchain: Pointer to the Blockchain to save
+ * @path: Path of the Blockchain file
+ * @written: If not NULL, receives the number of bytes written
+ *
+ * Description: The Blocks missing from path and its log are appended to
+ * the log, and synced to disk one Block at a time. Their changes to the
+ * unspent outputs follow from their transactions, and are replayed by
+ * blockchain_load().
+ *
+ * A new snapshot is written with blockchain_serialize() instead, and the
+ * log emptied, if there is no log yet, if its last record is damaged, if
+ * blockchain does not extend what was saved, if a Block to append has
+ * a version the format of the log cannot hold, or once the log would hold
+ * more than CHAIN_LOG_COMPACT_INTERVAL Blocks.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int blockchain_save_incremental(blockchain_t const *blockchain,
+								char const *path, size_t *written)
+{
+	chain_log_t log;
+	struct stat st;
+	block_t *block, *saved = NULL;
+	int32_t nb_blocks, nb_saved = 0;
+
+	if (!blockchain || !path)
+		return (-1);
+
+	nb_blocks = llist_size(blockchain->chain);
+	memset(&log, 0, sizeof(log));
+	if (stat(path, &st) == 0 && chain_log_open(&log, path, st.st_size) == 0)
+	{
+		while ((block = chain_log_next(&log)))
+			block_destroy(block);
+		nb_saved = log.snapshot_blocks + log.nb_records;
+		if (log.reader.pos == log.reader.len && nb_saved > 0 &&
+			nb_saved <= nb_blocks)
+			saved = blockchain_get_block_at(blockchain, nb_saved - 1);
+		chain_log_close(&log);
+	}
+
+	if (!saved || memcmp(saved->hash, log.last_hash, SHA256_DIGEST_LENGTH) ||
+		nb_blocks - log.snapshot_blocks > CHAIN_LOG_COMPACT_INTERVAL ||
+		(!log.reader.versioned && !blockchain_is_legacy(blockchain, nb_saved)))
+		return (blockchain_compact(blockchain, path, written));
+
+	return (chain_log_append(blockchain, path, nb_saved,
+							 log.reader.versioned, written));
+}
+
+/**
+ * blockchain_compact - Writes a new snapshot of a Blockchain, followed by
+ *						an empty log
+ * @blockchain: Pointer to the Blockchain to save
+ * @path: Path of the Blockchain file
+ * @written: If not NULL, receives the number of bytes written
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int blockchain_compact(blockchain_t const *blockchain, char const *path,
+					   size_t *written)
+{
+	struct stat st;
+
+	if (blockchain_serialize(blockchain, path) == -1 ||
+		stat(path, &st) == -1 ||
+		chain_log_create(path, blockchain, st.st_size) == -1)
+		return (-1);
+
+	if (written)
+		*written = st.st_size;
+	return (0);
+}
+
+/**
+ * chain_log_append - Appends the Blocks not saved yet to the log
+ * @blockchain: Pointer to the Blockchain to save
+ * @path: Path of the Blockchain file
+ * @nb_logged: Number of Blocks already in the file and its log
+ * @versioned: 1 if the records of the log hold the version of their Block
+ * @written: If not NULL, receives the number of bytes written
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int chain_log_append(blockchain_t const *blockchain, char const *path,
+					 int32_t nb_logged, int versioned, size_t *written)
+{
+	char *log_path = hblk_path_suffix(path, CHAIN_LOG_SUFFIX);
+	hblk_writer_t writer;
+	block_t *block;
+	void *arg[2];
+	int ret = 0;
+	uint32_t i;
+
+	if (!log_path || hblk_writer_append(&writer, log_path) == -1)
+	{
+		free(log_path);
+		return (-1);
+	}
+	free(log_path);
+	writer.versioned = versioned;
+
+	/* Only the Blocks past the saved ones are visited */
+	arg[0] = &writer, arg[1] = &nb_logged;
+	for (i = nb_logged; ret != -1 &&
+		 (block = blockchain_get_block_at(blockchain, i)); i++)
+		ret = append_block(block, i, arg);
+	if (hblk_writer_close(&writer) == -1)
+		ret = -1;
+
+	if (written)
+		*written = writer.written;
+	return (ret == -1 ? -1 : 0);
+}
+
+/**
+ * append_block - Appends a record to the log, unless the Block is
+ *				  already saved
+ * @node: void pointer to the Block
+ * @idx: index of the Block in the chain
+ * @arg: array holding the writer and the number of Blocks already saved
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int append_block(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	int32_t len;
+
+	if ((int32_t) idx < *(int32_t *) ptr[1])
+		return (0);
+
+	len = (int32_t) block_serialized_size(node,
+										  ((hblk_writer_t *) ptr[0])->versioned);
+	if (hblk_writer_write(ptr[0], &len, sizeof(len)) == -1 ||
+		block_serialize(node, idx, ptr[0]) == -1 ||
+		hblk_writer_sync(ptr[0]) == -1)
+		return (-1);
+
+	return (0);
+}
@@ -1,10 +1,12 @@
 #include "blockchain.h"
 
 /* Defined after */
-int header_serialize(FILE *file);
-int block_serialize(block_t *block, FILE *file);
-int tx_serialize(transaction_t *tx, FILE *file);
-int utxo_serialize(utxo_t *utxo, FILE *file);
+int header_serialize(hblk_writer_t *writer, int32_t nb_blocks,
+					 int32_t nb_unspent);
+int block_serialize(llist_node_t node, unsigned int idx, void *arg);
+int utxo_serialize(llist_node_t node, unsigned int idx, void *arg);
+/* Defined in tx_serialize.c */
+int tx_serialize(llist_node_t node, unsigned int idx, void *arg);
 
 /**
  * blockchain_serialize - Serializes a Blockchain into a file
@@ -13,202 +15,185 @@ int utxo_serialize(utxo_t *utxo, FILE *file);
  * Return: 0 upon success, or -1 upon failure
  *
  * If path points to an existing file, it must be overwritten
+ *
+ * The offset of each Block is also written to path.idx, so that the
+ * Blocks can be loaded in parallel, or one at a time, and the commitment
+ * to the unspent outputs to path.utxo, so that they can be checked
+ * without replaying the Blocks.
  */
 int blockchain_serialize(blockchain_t const *blockchain, char const *path)
 {
-	FILE *file;
-	int32_t nb_blocks, nb_unspent, i;
+	hblk_writer_t writer;
+	uint64_t *offsets;
+	int32_t nb_blocks;
+	int ret;
 
-	if (!blockchain || !path)
+	if (!blockchain || !path || hblk_writer_open(&writer, path) == -1)
 		return (-1);
 
+	nb_blocks = llist_size(blockchain->chain);
+	offsets = malloc((nb_blocks + 1) * sizeof(*offsets));
+	writer.offsets = offsets;
+	ret = blockchain_serialize_stream(blockchain, &writer);
+	if (ret == 0)
+		ret = hblk_writer_sync(&writer);
+
+	/* The index is optional, and on disk before the file it describes */
+	if (ret == 0 && (!offsets ||
+		blockchain_index_write(path, offsets, nb_blocks,
+							   writer.written) == -1))
+		blockchain_index_write(path, NULL, 0, 0);
+	if (hblk_writer_close(&writer) == -1)
+	{
+		if (ret == 0)
+			blockchain_index_write(path, NULL, 0, 0);
+		ret = -1;
+	}
+	if (ret == 0 &&
+		utxo_snapshot_write(path, blockchain, writer.written) == -1)
+		utxo_snapshot_write(path, NULL, 0);
+	free(offsets);
 
+	return (ret);
+}
 
-	file = fopen(path, "wb");
-	if (!file)
+/**
+ * blockchain_serialize_stream - Serializes a Blockchain through a writer
+ * @blockchain: Pointer to the Blockchain to be serialized
+ * @writer: Pointer to an open writer
+ *
+ * Description: Each list is walked once, from head to tail.
+ *
+ * A Blockchain made of BLOCK_VERSION_LIST Blocks only is written in the
+ * HBLK_VERSION format, any other in the HBLK_VERSION_MERKLE format, where
+ * each Block holds its version.
+ *
+ * Return: 0 upon success, or -1 upon failure
+*/
+int blockchain_serialize_stream(blockchain_t const *blockchain,
+								hblk_writer_t *writer)
+{
+	int32_t nb_blocks, nb_unspent;
+
+	if (!blockchain || !writer)
 		return (-1);
 
 	nb_blocks = llist_size(blockchain->chain);
 	nb_unspent = llist_size(blockchain->unspent);
-
-	/* Write the header */
-	if ((header_serialize(file) == -1) || (nb_blocks == -1))
-	{
-		fclose(file);
+	writer->versioned = !blockchain_is_legacy(blockchain, 0);
+	if (nb_blocks == -1 || nb_unspent == -1 ||
+		header_serialize(writer, nb_blocks, nb_unspent) == -1 ||
+		llist_for_each(blockchain->chain, block_serialize, writer) == -1)
 		return (-1);
-	}
-	/* Write nb_blocks */
-	if (HBLK_ENDIAN == 2) /* If system is big-endian, swap to little-endian */
-	{
-		SWAPENDIAN(nb_blocks);
-		SWAPENDIAN(nb_unspent);
-	}
-	fwrite(&nb_blocks, sizeof(nb_blocks), 1, file);
-	fwrite(&nb_unspent, sizeof(nb_unspent), 1, file);
-	/* Write each block */
-	for (i = 0; i < nb_blocks; i++)
-	{
-		block_t *block = llist_get_node_at(blockchain->chain, i);
 
-		if (block_serialize(block, file) == -1)
-		{
-			fclose(file);
-			return (-1);
-		}
-	}
-	/* Write each unspent */
-	for (i = 0; i < nb_unspent; i++)
-	{
-		utxo_t *utxo = llist_get_node_at(blockchain->unspent, i);
-
-		if (utxo_serialize(utxo, file) == -1)
-		{
-			fclose(file);
-			return (-1);
-		}
-	}
-	fclose(file);
+	if (writer->offsets)
+		writer->offsets[nb_blocks] = writer->written;
+	if (llist_for_each(blockchain->unspent, utxo_serialize, writer) == -1)
+		return (-1);
 
-	return (0);
+	return (writer->error ? -1 : 0);
 }
 
 /**
- * header_serialize - Serializes blockchain header into a file
- * @file: file to write
+ * header_serialize - Serializes blockchain header
+ * @writer: Pointer to the writer, its format is already chosen
+ * @nb_blocks: Number of Blocks in the Blockchain
+ * @nb_unspent: Number of unspent transaction outputs
  * Return: 0 upon success, or -1 upon failure
 */
-int header_serialize(FILE *file)
+int header_serialize(hblk_writer_t *writer, int32_t nb_blocks,
+					 int32_t nb_unspent)
 {
-	/* Need to store endian because fwrite takes an adress of a var */
 	uint8_t endian = HBLK_ENDIAN;
 
-	if (!file)
-		return (-1);
-
-	fwrite(HBLK_MAGIC, LEN_MAGIC, 1, file);
-	fwrite(HBLK_VERSION, LEN_VERSION, 1, file);
-	fwrite(&endian, sizeof(endian), 1, file);
+	/* If system is big-endian, swap to little-endian */
+	if (HBLK_ENDIAN == 2)
+	{
+		SWAPENDIAN(nb_blocks);
+		SWAPENDIAN(nb_unspent);
+	}
 
-	return (0);
+	hblk_writer_write(writer, HBLK_MAGIC, LEN_MAGIC);
+	hblk_writer_write(writer, writer->versioned ? HBLK_VERSION_MERKLE :
+					  HBLK_VERSION, LEN_VERSION);
+	hblk_writer_write(writer, &endian, sizeof(endian));
+	hblk_writer_write(writer, &nb_blocks, sizeof(nb_blocks));
+	return (hblk_writer_write(writer, &nb_unspent, sizeof(nb_unspent)));
 }
+
 /**
- * block_serialize - Serializes a Block into a file
- * @block: Pointer to the Block to be serialized,
- * @file: file to write
+ * block_serialize - Serializes a Block
+ * @node: void pointer to the Block to be serialized
+ * @idx: index of the Block in the chain
+ * @arg: void pointer to the writer
  * Return: 0 upon success, or -1 upon failure
  */
-int block_serialize(block_t *block, FILE *file)
+int block_serialize(llist_node_t node, unsigned int idx, void *arg)
 {
+	block_t *block = node;
+	hblk_writer_t *writer = arg;
 	block_info_t info;
-	block_data_t data;
-	int32_t nb_transactions, i;
+	uint32_t data_len;
+	int32_t nb_transactions;
 
-	if (!block || !file)
+	if (!block)
 		return (-1);
 
+	if (writer->offsets)
+		writer->offsets[idx] = writer->written;
 	info = block->info;
-	data = block->data;
+	data_len = block->data.len;
 	nb_transactions = llist_size(block->transactions);
 
 	/* Convert endianess if system is big endian */
 	if (HBLK_ENDIAN == 2)
 	{
 		SWAPENDIAN(info);
-		SWAPENDIAN(data.len);
+		SWAPENDIAN(data_len);
 		SWAPENDIAN(nb_transactions);
 	}
-	/* Write block */
-	fwrite(&info, sizeof(info), 1, file);
-	fwrite(&(data.len), sizeof(data.len), 1, file);
-	fwrite(data.buffer, data.len, 1, file);
-	fwrite(block->hash, SHA256_DIGEST_LENGTH, 1, file);
-	fwrite(&(nb_transactions), sizeof(nb_transactions), 1, file);
-	for (i = 0; i < nb_transactions; i++)
-	{
-		transaction_t *tx = llist_get_node_at(block->transactions, i);
-
-		if (tx_serialize(tx, file) == -1)
-			return (-1);
-	}
-	return (0);
-}
-
-/**
- * tx_serialize - serializes a transaction in a file
- * @tx: pointer to transaction to serialize
- * @file: file fointer to write the transaction in
- *
- * Return: 0 if success, otherwise -1
-*/
-int tx_serialize(transaction_t *tx, FILE *file)
-{
-	int32_t nb_inputs, nb_outputs, i;
-
-	if (!tx || !file)
+	hblk_writer_write(arg, &info, sizeof(info));
+	hblk_writer_write(arg, &data_len, sizeof(data_len));
+	hblk_writer_write(arg, block->data.buffer, block->data.len);
+	hblk_writer_write(arg, block->hash, SHA256_DIGEST_LENGTH);
+	if (writer->versioned)
+		hblk_writer_write(arg, &block->version, sizeof(block->version));
+	if (hblk_writer_write(arg, &nb_transactions,
+						  sizeof(nb_transactions)) == -1)
 		return (-1);
 
-	nb_inputs = llist_size(tx->inputs);
-	nb_outputs = llist_size(tx->outputs);
-
-	if (HBLK_ENDIAN == 2)
-	{
-		SWAPENDIAN(nb_inputs);
-		SWAPENDIAN(nb_outputs);
-	}
-
-	fwrite(tx->id, SHA256_DIGEST_LENGTH, 1, file);
-	fwrite(&nb_inputs, sizeof(nb_inputs), 1, file);
-	fwrite(&nb_outputs, sizeof(nb_outputs), 1, file);
-
-	for (i = 0; i < nb_inputs; i++)
-	{
-		tx_in_t *tx_in = llist_get_node_at(tx->inputs, i);
-
-		fwrite(tx_in, sizeof(*tx_in), 1, file);
-	}
-
-	for (i = 0; i < nb_outputs; i++)
-	{
-		tx_out_t *tx_out = llist_get_node_at(tx->outputs, i);
-		uint32_t amount = tx_out->amount;
-
-		if (HBLK_ENDIAN == 2)
-			SWAPENDIAN(amount);
-
-		fwrite(&amount, sizeof(amount), 1, file);
-		fwrite(tx_out->pub, EC_PUB_LEN, 1, file);
-		fwrite(tx_out->hash, SHA256_DIGEST_LENGTH, 1, file);
-	}
+	/* The genesis Block has no list, -1 is written as its size */
+	if (block->transactions &&
+		block_for_each_tx(block, tx_serialize, arg) == -1)
+		return (-1);
 
 	return (0);
 }
 
 /**
- * utxo_serialize - serializes a utxo in a file
- * @utxo: pointer to utxo to serialize
- * @file: file pointer to write the utxo in
+ * utxo_serialize - serializes a utxo
+ * @node: void pointer to the utxo to serialize
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the writer
  *
  * Return: 0 if success, otherwise -1
 */
-int utxo_serialize(utxo_t *utxo, FILE *file)
+int utxo_serialize(llist_node_t node, unsigned int idx, void *arg)
 {
-	tx_out_t tx_out;
+	utxo_t *utxo = node;
 	uint32_t amount;
 
-	if (!utxo || !file)
+	if (!utxo)
 		return (-1);
 
-	tx_out = utxo->out;
-	amount = tx_out.amount;
-
+	amount = utxo->out.amount;
 	if (HBLK_ENDIAN == 2)
 		SWAPENDIAN(amount);
 
-	fwrite(utxo->block_hash, SHA256_DIGEST_LENGTH, 1, file);
-	fwrite(utxo->tx_id, SHA256_DIGEST_LENGTH, 1, file);
-	fwrite(&amount, sizeof(amount), 1, file);
-	fwrite(tx_out.pub, EC_PUB_LEN, 1, file);
-	fwrite(tx_out.hash, SHA256_DIGEST_LENGTH, 1, file);
-
-	return (0);
+	hblk_writer_write(arg, utxo->block_hash, SHA256_DIGEST_LENGTH);
+	hblk_writer_write(arg, utxo->tx_id, SHA256_DIGEST_LENGTH);
+	hblk_writer_write(arg, &amount, sizeof(amount));
+	hblk_writer_write(arg, utxo->out.pub, EC_PUB_LEN);
+	return (hblk_writer_write(arg, utxo->out.hash, SHA256_DIGEST_LENGTH));
+	(void)idx;
 }
@@ -0,0 +1,107 @@
+#include "blockchain.h"
+
+/* Defined after */
+int index_block(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * chain_index_create - Indexes the Blocks of a chain by height and by hash,
+ *						and their transactions by ID
+ * @chain: List of Blocks to index, may be NULL to start with an empty index
+ * @nthreads: Number of threads indexing the transactions,
+ *			  0 to use every online CPU
+ *
+ * Return: Pointer to the created index, or NULL on failure
+*/
+chain_index_t *chain_index_create(llist_t *chain, unsigned int nthreads)
+{
+	chain_index_t *index = calloc(1, sizeof(*index));
+	int size = chain ? llist_size(chain) : 0;
+
+	if (!index)
+		return (NULL);
+
+	if (probe_reserve(&index->hashes, &chain_index_ops,
+					  size > 0 ? (size_t)size : 0) == -1 ||
+		(chain && llist_for_each(chain, index_block, index) == -1) ||
+		tx_index_build(index, nthreads) == -1)
+	{
+		chain_index_destroy(index);
+		return (NULL);
+	}
+
+	return (index);
+}
+
+/**
+ * chain_index_destroy - Deletes an index, the indexed Blocks are untouched
+ * @index: Pointer to the index to delete
+*/
+void chain_index_destroy(chain_index_t *index)
+{
+	size_t s;
+
+	if (!index)
+		return;
+
+	for (s = 0; s < TX_INDEX_SHARDS; s++)
+		probe_clear(&index->tx_shards[s]);
+	free(index->blocks);
+	probe_clear(&index->hashes);
+	free(index);
+}
+
+/**
+ * chain_index_add_block - Indexes the Block appended to an indexed chain,
+ *						   leaving its transactions to the caller
+ * @index: Pointer to the index to update
+ * @block: Block to add, at the height following the last indexed Block
+ *
+ * Return: 0 on success, -1 on failure, the index being untouched
+*/
+int chain_index_add_block(chain_index_t *index, block_t *block)
+{
+	block_t **blocks, **slot;
+	size_t i;
+
+	if (!index || !block)
+		return (-1);
+
+	if (index->nb_blocks == index->blocks_capacity)
+	{
+		blocks = realloc(index->blocks, (index->blocks_capacity * 2 + 1) *
+						 sizeof(*blocks));
+		if (!blocks)
+			return (-1);
+		index->blocks = blocks;
+		index->blocks_capacity = index->blocks_capacity * 2 + 1;
+	}
+	if (probe_reserve(&index->hashes, &chain_index_ops, 1) == -1)
+		return (-1);
+
+	/* A Block of the same hash already indexed keeps being found first */
+	i = probe_find(&index->hashes, &chain_index_ops,
+				   chain_index_hash(block->hash), block_slot_is, block->hash);
+	slot = probe_at(&index->hashes, &chain_index_ops, i);
+	if (!*slot)
+	{
+		slot = probe_claim(&index->hashes, &chain_index_ops, i);
+		*slot = block;
+	}
+	index->blocks[index->nb_blocks++] = block;
+
+	return (0);
+}
+
+/**
+ * index_block - Adds a Block of a chain to an index
+ * @node: void pointer to the block_t to index
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the chain_index_t to update
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int index_block(llist_node_t node, unsigned int idx, void *arg)
+{
+	return (chain_index_add_block((chain_index_t *) arg, (block_t *) node));
+	(void)idx;
+}
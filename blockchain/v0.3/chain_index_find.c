@@ -0,0 +1,126 @@
+#include "blockchain.h"
+
+/* Defined after */
+int block_hash_is(llist_node_t node, void *arg);
+
+/**
+ * chain_index_hash - Hashes the hash of a Block into a slot number
+ * @hash: Hash of the Block
+ *
+ * Description: The first bytes of a Block hash are zeroed by its
+ * difficulty, its last bytes are used instead.
+ *
+ * Return: Hash value, to be masked by the capacity of the index
+*/
+size_t chain_index_hash(uint8_t const hash[SHA256_DIGEST_LENGTH])
+{
+	size_t h;
+
+	memcpy(&h, hash + SHA256_DIGEST_LENGTH - sizeof(h), sizeof(h));
+	return (h);
+}
+
+/**
+ * chain_index_sync - Catches an index up with its chain
+ * @index: Pointer to the index to update
+ * @chain: List of Blocks indexed by @index
+ *
+ * Description: A Block appended to the chain since the last call is
+ * indexed on its own. If the chain was changed in any other way, the
+ * index is built again.
+ *
+ * Return: 0 on success, -1 on failure, the index being untouched
+*/
+int chain_index_sync(chain_index_t *index, llist_t *chain)
+{
+	int size = llist_size(chain);
+	block_t *tail = llist_get_tail(chain), *last;
+	chain_index_t *fresh, old;
+
+	if (!index || size < 0)
+		return (-1);
+
+	last = index->nb_blocks ? index->blocks[index->nb_blocks - 1] : NULL;
+	if ((size_t)size == index->nb_blocks && last == tail)
+		return (0);
+	if ((size_t)size == index->nb_blocks + 1 && last &&
+		!memcmp(tail->info.prev_hash, last->hash, SHA256_DIGEST_LENGTH))
+		return (chain_index_add(index, tail));
+
+	fresh = chain_index_create(chain, 1);
+	if (!fresh)
+		return (-1);
+	/* The old content is destroyed along with the fresh index */
+	old = *index, *index = *fresh, *fresh = old;
+	chain_index_destroy(fresh);
+	return (0);
+}
+
+/**
+ * blockchain_get_block_at - Gets the Block at a given height of a
+ *							 Blockchain
+ * @blockchain: Pointer to the Blockchain
+ * @index: Height of the Block, 0 being the Genesis Block
+ *
+ * Description: The chain index of the Blockchain is caught up with the
+ * chain first, so lookups must not run concurrently with each other while
+ * Blocks are appended. Without a usable index, the chain is walked.
+ *
+ * Return: Pointer to the Block, or NULL if the chain is not that long
+*/
+block_t *blockchain_get_block_at(blockchain_t const *blockchain,
+								 uint32_t index)
+{
+	chain_index_t *chain_index;
+
+	if (!blockchain)
+		return (NULL);
+
+	chain_index = blockchain->chain_index;
+	if (!chain_index || chain_index_sync(chain_index, blockchain->chain) == -1)
+		return (llist_get_node_at(blockchain->chain, index));
+
+	return (index < chain_index->nb_blocks ?
+			chain_index->blocks[index] : NULL);
+}
+
+/**
+ * blockchain_get_block_by_hash - Finds a Block of a Blockchain by its hash
+ * @blockchain: Pointer to the Blockchain
+ * @hash: Hash of the Block, SHA256_DIGEST_LENGTH bytes long
+ *
+ * Description: Like blockchain_get_block_at(), the chain index is caught
+ * up with the chain first.
+ *
+ * Return: Pointer to the Block, or NULL if not found
+*/
+block_t *blockchain_get_block_by_hash(blockchain_t const *blockchain,
+									  uint8_t const *hash)
+{
+	chain_index_t *chain_index;
+	block_t **slot;
+
+	if (!blockchain || !hash)
+		return (NULL);
+
+	chain_index = blockchain->chain_index;
+	if (!chain_index || chain_index_sync(chain_index, blockchain->chain) == -1)
+		return (llist_find_node(blockchain->chain, block_hash_is,
+								(void *) hash));
+
+	slot = probe_get(&chain_index->hashes, &chain_index_ops,
+					 chain_index_hash(hash), block_slot_is, hash);
+	return (slot ? *slot : NULL);
+}
+
+/**
+ * block_hash_is - Checks whether a Block has a given hash
+ * @node: void pointer to the Block
+ * @arg: hash to look for
+ *
+ * Return: 1 if the hash of the Block is @arg, 0 otherwise
+*/
+int block_hash_is(llist_node_t node, void *arg)
+{
+	return (!memcmp(((block_t *) node)->hash, arg, SHA256_DIGEST_LENGTH));
+}
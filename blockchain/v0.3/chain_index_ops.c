@@ -0,0 +1,44 @@
+#include "blockchain.h"
+
+/* Defined after */
+int block_slot_state(void const *slot);
+size_t block_slot_hash(void const *slot);
+
+probe_ops_t const chain_index_ops = {
+	sizeof(block_t *), block_slot_state, block_slot_hash, NULL
+};
+
+/**
+ * block_slot_state - Tells whether a slot of a chain index is used
+ * @slot: void pointer to the block_t pointer of the slot
+ *
+ * Return: PROBE_USED if the slot points to a Block, PROBE_EMPTY otherwise
+*/
+int block_slot_state(void const *slot)
+{
+	return (*(block_t * const *) slot ? PROBE_USED : PROBE_EMPTY);
+}
+
+/**
+ * block_slot_hash - Computes the hash table key of the Block of a slot
+ * @slot: void pointer to the used block_t pointer
+ *
+ * Return: Hash table key, see chain_index_hash()
+*/
+size_t block_slot_hash(void const *slot)
+{
+	return (chain_index_hash((*(block_t * const *) slot)->hash));
+}
+
+/**
+ * block_slot_is - Checks whether the Block of a slot has a given hash
+ * @slot: void pointer to the used block_t pointer
+ * @key: Hash to look for, SHA256_DIGEST_LENGTH bytes long
+ *
+ * Return: 1 if the Block has this hash, 0 otherwise
+*/
+int block_slot_is(void const *slot, void const *key)
+{
+	return (!memcmp((*(block_t * const *) slot)->hash, key,
+					SHA256_DIGEST_LENGTH));
+}
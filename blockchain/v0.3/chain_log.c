@@ -0,0 +1,135 @@
+#include "blockchain.h"
+
+/**
+ * chain_log_create - Starts an empty log after a Blockchain file
+ * @path: Path of the Blockchain file, the log is written to path.log
+ * @blockchain: Blockchain just written to path
+ * @snapshot_size: Size of the file at path
+ *
+ * Description: The log has the format of the file, its records hold the
+ * version of their Block in the HBLK_VERSION_MERKLE format.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int chain_log_create(char const *path, blockchain_t const *blockchain,
+					 uint64_t snapshot_size)
+{
+	char *log_path = hblk_path_suffix(path, CHAIN_LOG_SUFFIX);
+	block_t const *last = llist_get_tail(blockchain->chain);
+	int32_t nb_blocks = llist_size(blockchain->chain);
+	uint8_t endian = HBLK_ENDIAN;
+	hblk_writer_t writer;
+	int ret;
+
+	if (!log_path || !last || hblk_writer_open(&writer, log_path) == -1)
+	{
+		free(log_path);
+		return (-1);
+	}
+
+	hblk_writer_write(&writer, CHAIN_LOG_MAGIC, LEN_MAGIC);
+	hblk_writer_write(&writer, blockchain_is_legacy(blockchain, 0) ?
+					  HBLK_VERSION : HBLK_VERSION_MERKLE, LEN_VERSION);
+	hblk_writer_write(&writer, &endian, sizeof(endian));
+	hblk_writer_write(&writer, &snapshot_size, sizeof(snapshot_size));
+	hblk_writer_write(&writer, &nb_blocks, sizeof(nb_blocks));
+	hblk_writer_write(&writer, last->hash, SHA256_DIGEST_LENGTH);
+	ret = hblk_writer_close(&writer);
+
+	free(log_path);
+	return (ret);
+}
+
+/**
+ * chain_log_open - Maps the log of a Blockchain file
+ * @log: Pointer to the log to initialize
+ * @path: Path of the Blockchain file, the log is read from path.log
+ * @snapshot_size: Size of the file at path
+ *
+ * Return: 0 on success, -1 if there is no log, or if it was written after
+ *		   another version of the file
+*/
+int chain_log_open(chain_log_t *log, char const *path,
+				   uint64_t snapshot_size)
+{
+	char *log_path = hblk_path_suffix(path, CHAIN_LOG_SUFFIX);
+	hblk_reader_t *reader = &log->reader;
+	int ok;
+
+	memset(log, 0, sizeof(*log));
+	if (!log_path || hblk_reader_open(reader, log_path) == -1)
+	{
+		free(log_path);
+		return (-1);
+	}
+	free(log_path);
+
+	reader->endian = reader->len > LEN_MAGIC + LEN_VERSION ?
+					 reader->base[LEN_MAGIC + LEN_VERSION] : 0;
+	ok = reader->len > LEN_MAGIC + LEN_VERSION &&
+		 !memcmp(reader->base, CHAIN_LOG_MAGIC, LEN_MAGIC) &&
+		 hblk_reader_version(reader, reader->base + LEN_MAGIC) == 0 &&
+		 hblk_reader_take(reader, LEN_MAGIC + LEN_VERSION + 1) &&
+		 hblk_reader_uint64(reader, &log->snapshot_size) == 0 &&
+		 log->snapshot_size == snapshot_size &&
+		 hblk_reader_int32(reader, &log->snapshot_blocks) == 0 &&
+		 hblk_reader_read(reader, log->last_hash, SHA256_DIGEST_LENGTH) == 0;
+	if (!ok)
+	{
+		chain_log_close(log);
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * chain_log_next - Reads the next record of a log
+ * @log: Pointer to the log
+ *
+ * Description: A record is valid if it holds a whole Block, whose hashes
+ * match and which follows the last Block read. A record cut short by a
+ * crash while it was appended is thus never returned.
+ *
+ * Return: Pointer to the Block, owning all its memory, or NULL once there
+ *		   is no valid record left
+*/
+block_t *chain_log_next(chain_log_t *log)
+{
+	hblk_reader_t reader = log->reader;
+	block_t *block;
+	int32_t len;
+	size_t start;
+
+	if (hblk_reader_int32(&reader, &len) == -1 || len < 0)
+		return (NULL);
+
+	start = reader.pos;
+	block = block_deserialize_mapped(&reader);
+	if (!block)
+		return (NULL);
+	if (reader.pos - start != (size_t)len || !block_hashes_match(block) ||
+		memcmp(block->info.prev_hash, log->last_hash, SHA256_DIGEST_LENGTH) ||
+		block_own_inputs(block) == -1)
+	{
+		block_destroy(block);
+		return (NULL);
+	}
+
+	log->reader.pos = reader.pos;
+	log->nb_records++;
+	memcpy(log->last_hash, block->hash, SHA256_DIGEST_LENGTH);
+	return (block);
+}
+
+/**
+ * chain_log_close - Unmaps a log
+ * @log: Pointer to the log
+*/
+void chain_log_close(chain_log_t *log)
+{
+	if (log && log->reader.base)
+		munmap(log->reader.base, log->reader.len);
+	if (log)
+		log->reader.base = NULL;
+}
@@ -0,0 +1,112 @@
+#include "blockchain.h"
+
+/**
+ * hblk_reader_open - Maps a Blockchain file in memory
+ * @reader: Pointer to the reader to initialize
+ * @path: Path of the file to map
+ *
+ * Description: The mapping is private and writable: a page written to is
+ * copied by the kernel, the file itself is never modified. The header of
+ * the file is not checked.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_reader_open(hblk_reader_t *reader, char const *path)
+{
+	struct stat st;
+	void *map = MAP_FAILED;
+	int fd;
+
+	if (!reader || !path)
+		return (-1);
+
+	memset(reader, 0, sizeof(*reader));
+	fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return (-1);
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+		map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+				   fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (-1);
+
+	reader->base = map;
+	reader->len = st.st_size;
+	return (0);
+}
+
+/**
+ * hblk_reader_take - Consumes bytes of a mapped file, without copying them
+ * @reader: Pointer to the reader
+ * @len: Number of bytes to consume
+ *
+ * Return: Pointer to the first byte consumed, or NULL if fewer than len
+ *		   bytes are left
+*/
+void *hblk_reader_take(hblk_reader_t *reader, size_t len)
+{
+	void *ptr;
+
+	if (!reader || len > reader->len - reader->pos)
+		return (NULL);
+
+	ptr = reader->base + reader->pos;
+	reader->pos += len;
+	return (ptr);
+}
+
+/**
+ * hblk_reader_read - Copies bytes of a mapped file
+ * @reader: Pointer to the reader
+ * @dest: Buffer receiving the bytes
+ * @len: Number of bytes to copy
+ *
+ * Return: 0 on success, -1 if fewer than len bytes are left
+*/
+int hblk_reader_read(hblk_reader_t *reader, void *dest, size_t len)
+{
+	void *src = hblk_reader_take(reader, len);
+
+	if (!src)
+		return (-1);
+
+	memcpy(dest, src, len);
+	return (0);
+}
+
+/**
+ * hblk_reader_int32 - Reads a 32-bit integer stored with the endianness
+ *					   of the file
+ * @reader: Pointer to the reader
+ * @value: Pointer receiving the integer, with the endianness of the system
+ *
+ * Return: 0 on success, -1 if fewer than 4 bytes are left
+*/
+int hblk_reader_int32(hblk_reader_t *reader, int32_t *value)
+{
+	if (hblk_reader_read(reader, value, sizeof(*value)) == -1)
+		return (-1);
+
+	if (reader->endian != HBLK_ENDIAN)
+		SWAPENDIAN(*value);
+	return (0);
+}
+
+/**
+ * hblk_reader_uint64 - Reads a 64-bit integer stored with the endianness
+ *						of the file
+ * @reader: Pointer to the reader
+ * @value: Pointer receiving the integer, with the endianness of the system
+ *
+ * Return: 0 on success, -1 if fewer than 8 bytes are left
+*/
+int hblk_reader_uint64(hblk_reader_t *reader, uint64_t *value)
+{
+	if (hblk_reader_read(reader, value, sizeof(*value)) == -1)
+		return (-1);
+
+	if (reader->endian != HBLK_ENDIAN)
+		SWAPENDIAN(*value);
+	return (0);
+}
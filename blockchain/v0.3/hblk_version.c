@@ -0,0 +1,50 @@
+#include "blockchain.h"
+
+/**
+ * hblk_reader_version - Checks the version read from the header of a file
+ * @reader: Pointer to the reader, told whether the Blocks of the file
+ *			hold their version
+ * @version: LEN_VERSION bytes read from the header
+ *
+ * Return: 0 if the version is HBLK_VERSION or HBLK_VERSION_MERKLE,
+ *		   -1 otherwise
+*/
+int hblk_reader_version(hblk_reader_t *reader, uint8_t const *version)
+{
+	if (!version)
+		return (-1);
+
+	if (!memcmp(version, HBLK_VERSION_MERKLE, LEN_VERSION))
+		reader->versioned = 1;
+	else if (!memcmp(version, HBLK_VERSION, LEN_VERSION))
+		reader->versioned = 0;
+	else
+		return (-1);
+
+	return (0);
+}
+
+/**
+ * blockchain_is_legacy - Checks whether the Blocks of a Blockchain can be
+ *						  written in the HBLK_VERSION format
+ * @blockchain: Pointer to the Blockchain
+ * @first: Index of the first Block to check
+ *
+ * Description: Such files are written byte for byte as before Blocks had
+ * a version, and can be read by older programs.
+ *
+ * Return: 1 if every Block from first on is a BLOCK_VERSION_LIST Block,
+ *		   0 otherwise
+*/
+int blockchain_is_legacy(blockchain_t const *blockchain, uint32_t first)
+{
+	block_t const *block;
+
+	for (; (block = blockchain_get_block_at(blockchain, first)); first++)
+	{
+		if (block->version != BLOCK_VERSION_LIST)
+			return (0);
+	}
+
+	return (1);
+}
@@ -0,0 +1,141 @@
+#include "blockchain.h"
+
+/* Defined after */
+int hblk_sync_dir(char *path);
+
+/**
+ * hblk_writer_open - Opens a file for writing through a large buffer
+ * @writer: Pointer to the writer to initialize
+ * @path: Path of the file, overwritten if it exists
+ *
+ * Description: Every byte is copied once into the writer's buffer, which
+ * is written in a single call when full.
+ *
+ * The bytes go to a temporary file, renamed to path once complete. An
+ * existing file is thus replaced at once, and never truncated while a
+ * Blockchain loaded from it may still have it mapped.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_writer_open(hblk_writer_t *writer, char const *path)
+{
+	size_t len;
+
+	if (!writer || !path)
+		return (-1);
+
+	memset(writer, 0, sizeof(*writer));
+	writer->fd = -1;
+	len = strlen(path);
+	writer->path = malloc(2 * len + sizeof(HBLK_WRITER_TMP_SUFFIX) + 1);
+	writer->buf = malloc(HBLK_WRITER_BUFSIZE);
+	if (writer->path && writer->buf)
+	{
+		writer->tmp = writer->path + len + 1;
+		strcpy(writer->path, path);
+		strcpy(writer->tmp, path);
+		strcat(writer->tmp, HBLK_WRITER_TMP_SUFFIX);
+		writer->fd = open(writer->tmp, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	}
+	if (writer->fd == -1)
+	{
+		free(writer->path), free(writer->buf);
+		writer->path = NULL, writer->tmp = NULL, writer->buf = NULL;
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * hblk_writer_append - Opens an existing file for appending through a large
+ *						buffer
+ * @writer: Pointer to the writer to initialize
+ * @path: Path of the file, written to in place
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_writer_append(hblk_writer_t *writer, char const *path)
+{
+	if (!writer || !path)
+		return (-1);
+
+	memset(writer, 0, sizeof(*writer));
+	writer->buf = malloc(HBLK_WRITER_BUFSIZE);
+	writer->fd = writer->buf ? open(path, O_WRONLY | O_APPEND) : -1;
+	if (writer->fd == -1)
+	{
+		free(writer->buf);
+		writer->buf = NULL;
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * hblk_writer_close - Flushes and closes a writer, and moves the file
+ *					   in place
+ * @writer: Pointer to the writer, its buffers are released
+ *
+ * Description: The temporary file reaches the disk before it is renamed,
+ * and the rename before this returns, so a crash leaves either the old
+ * file or the complete new one at path.
+ *
+ * Return: 0 if every byte was written, -1 otherwise, in which case the
+ *		   temporary file is removed and path is left untouched
+*/
+int hblk_writer_close(hblk_writer_t *writer)
+{
+	int ret;
+
+	if (!writer || writer->fd == -1)
+		return (-1);
+
+	ret = writer->tmp ? hblk_writer_sync(writer) : hblk_writer_flush(writer);
+	if (close(writer->fd) != 0)
+		ret = -1;
+	if (writer->tmp)
+	{
+		if (ret == 0 && (rename(writer->tmp, writer->path) != 0 ||
+						 hblk_sync_dir(writer->path) != 0))
+			ret = -1;
+		if (ret == -1)
+			remove(writer->tmp);
+	}
+	free(writer->path), free(writer->buf);
+	writer->fd = -1, writer->buf = NULL;
+	writer->path = NULL, writer->tmp = NULL;
+
+	return (ret);
+}
+
+/**
+ * hblk_sync_dir - Waits for the entries of the directory of a file to reach
+ *				   the disk
+ * @path: Path of the file, cut at its last '/' and restored
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_sync_dir(char *path)
+{
+	char *slash = strrchr(path, '/'), c = 0;
+	int fd, ret;
+
+	if (slash)
+	{
+		/* The root directory keeps its '/' */
+		slash += slash == path;
+		c = *slash, *slash = '\0';
+	}
+	fd = open(slash ? path : ".", O_RDONLY);
+	if (slash)
+		*slash = c;
+	if (fd == -1)
+		return (-1);
+
+	ret = fsync(fd) == 0 ? 0 : -1;
+	if (close(fd) != 0)
+		ret = -1;
+	return (ret);
+}
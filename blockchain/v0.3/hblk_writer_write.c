@@ -0,0 +1,107 @@
+#include "blockchain.h"
+
+/* Defined after */
+int hblk_write_all(int fd, void const *data, size_t len);
+
+/**
+ * hblk_writer_write - Appends bytes to a file opened by a writer
+ * @writer: Pointer to the writer
+ * @data: Bytes to write
+ * @len: Number of bytes to write
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_writer_write(hblk_writer_t *writer, void const *data, size_t len)
+{
+	if (!writer || writer->error)
+		return (-1);
+
+	if (len > HBLK_WRITER_BUFSIZE - writer->len)
+	{
+		if (hblk_writer_flush(writer) == -1)
+			return (-1);
+		/* Too large to be buffered, written as is */
+		if (len >= HBLK_WRITER_BUFSIZE)
+		{
+			if (hblk_write_all(writer->fd, data, len) == -1)
+			{
+				writer->error = 1;
+				return (-1);
+			}
+			writer->written += len;
+			return (0);
+		}
+	}
+
+	memcpy(writer->buf + writer->len, data, len);
+	writer->len += len;
+	writer->written += len;
+
+	return (0);
+}
+
+/**
+ * hblk_writer_flush - Writes the buffered bytes to the file
+ * @writer: Pointer to the writer
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_writer_flush(hblk_writer_t *writer)
+{
+	if (!writer || writer->error)
+		return (-1);
+
+	if (hblk_write_all(writer->fd, writer->buf, writer->len) == -1)
+	{
+		writer->error = 1;
+		return (-1);
+	}
+	writer->len = 0;
+
+	return (0);
+}
+
+/**
+ * hblk_writer_sync - Writes the buffered bytes, and waits for them to reach
+ *					  the disk
+ * @writer: Pointer to the writer
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_writer_sync(hblk_writer_t *writer)
+{
+	if (hblk_writer_flush(writer) == -1)
+		return (-1);
+
+	if (fsync(writer->fd) != 0)
+	{
+		writer->error = 1;
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * hblk_write_all - Writes a whole buffer to a file descriptor
+ * @fd: File descriptor
+ * @data: Bytes to write
+ * @len: Number of bytes to write
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int hblk_write_all(int fd, void const *data, size_t len)
+{
+	uint8_t const *bytes = data;
+	ssize_t ret;
+
+	while (len)
+	{
+		ret = write(fd, bytes, len);
+		if (ret <= 0)
+			return (-1);
+		bytes += ret, len -= ret;
+	}
+
+	return (0);
+}
@@ -0,0 +1,122 @@
+#include "blockchain.h"
+
+/* Address used to mark the slots of removed entries */
+mempool_entry_t mempool_tombstone;
+
+/**
+ * mempool_create - Creates an empty mempool
+ *
+ * Return: Pointer to the mempool, or NULL on failure
+*/
+mempool_t *mempool_create(void)
+{
+	return (calloc(1, sizeof(mempool_t)));
+}
+
+/**
+ * mempool_destroy - Deletes a mempool, along with its transactions
+ * @pool: Pointer to the mempool to delete
+*/
+void mempool_destroy(mempool_t *pool)
+{
+	mempool_entry_t *entry, *next;
+
+	if (!pool)
+		return;
+
+	for (entry = pool->head; entry; entry = next)
+	{
+		next = entry->next;
+		transaction_destroy(entry->tx);
+		free(entry);
+	}
+	probe_clear(&pool->ids);
+	probe_clear(&pool->outpoints);
+	free(pool);
+}
+
+/**
+ * mempool_add - Adds a transaction to a mempool
+ * @pool: Pointer to the mempool
+ * @tx: Transaction to add, owned by pool on success
+ * @index: Hash index of the unspent outputs the transaction is checked
+ *		   against
+ *
+ * Description: A transaction already pending, or spending an output
+ * already spent by a pending transaction, is rejected without its
+ * signatures being verified. The transaction is checked once, when it is
+ * added: mempool_remove_block() then keeps the pending transactions valid
+ * as Blocks are added.
+ *
+ * Return: 1 if tx was added, 0 if it was rejected, -1 on failure
+*/
+int mempool_add(mempool_t *pool, transaction_t *tx,
+				utxo_index_t const *index)
+{
+	mempool_entry_t *entry;
+	int nb_inputs;
+	void *arg[2];
+
+	if (!pool || !tx || !index)
+		return (-1);
+
+	nb_inputs = llist_size(tx->inputs);
+	if (nb_inputs < 1 || mempool_find(pool, tx->id))
+		return (0);
+	entry = mempool_reserve(pool, nb_inputs) == 0 ?
+			calloc(1, sizeof(*entry)) : NULL;
+	if (!entry)
+		return (-1);
+
+	entry->tx = tx;
+	*(mempool_entry_t **) probe_claim(&pool->ids, &mempool_ids_ops,
+									  mempool_id_slot(pool, tx->id)) = entry;
+	entry->prev = pool->tail;
+	if (pool->tail)
+		pool->tail->next = entry;
+	else
+		pool->head = entry;
+	pool->tail = entry;
+	pool->size++;
+
+	arg[0] = pool, arg[1] = entry;
+	if (tx_inputs_for_each(tx, mempool_index_input, arg) == -1 ||
+		transaction_is_valid_indexed(tx, index) != 1)
+	{
+		mempool_remove(pool, entry);
+		return (0);
+	}
+
+	return (1);
+}
+
+/**
+ * mempool_remove - Removes an entry from a mempool
+ * @pool: Pointer to the mempool
+ * @entry: Entry to remove, freed
+ *
+ * Return: Transaction of the entry, no longer owned by pool
+*/
+transaction_t *mempool_remove(mempool_t *pool, mempool_entry_t *entry)
+{
+	transaction_t *tx = entry->tx;
+	void *arg[2];
+
+	arg[0] = pool, arg[1] = entry;
+	tx_inputs_for_each(tx, mempool_unindex_input, arg);
+	probe_release(&pool->ids, &mempool_ids_ops,
+				  mempool_id_slot(pool, tx->id));
+
+	if (entry->prev)
+		entry->prev->next = entry->next;
+	else
+		pool->head = entry->next;
+	if (entry->next)
+		entry->next->prev = entry->prev;
+	else
+		pool->tail = entry->prev;
+	pool->size--;
+
+	free(entry);
+	return (tx);
+}
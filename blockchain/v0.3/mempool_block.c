@@ -0,0 +1,146 @@
+#include "blockchain.h"
+
+/* Defined after */
+int evict_mined(llist_node_t node, unsigned int idx, void *arg);
+int evict_spender(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * mempool_template - Moves the oldest pending transactions to a Block
+ * @pool: Pointer to the mempool
+ * @block: Block to append the transactions to, owning them on success
+ * @max: Maximum number of transactions to move
+ *
+ * Description: The pending transactions spend distinct outputs, and were
+ * checked against the unspent outputs the Block is built on, so they are
+ * not checked again. Moving k transactions costs O(k), whatever the size
+ * of the mempool.
+ *
+ * Return: Number of transactions moved, or -1 on failure
+*/
+int mempool_template(mempool_t *pool, block_t *block, size_t max)
+{
+	size_t nb_moved;
+
+	if (!pool || !block)
+		return (-1);
+
+	for (nb_moved = 0; pool->head && nb_moved < max; nb_moved++)
+	{
+		if (llist_add_node(block->transactions, pool->head->tx,
+						   ADD_NODE_REAR) == -1)
+			return (-1);
+		mempool_remove(pool, pool->head);
+	}
+
+	return ((int)nb_moved);
+}
+
+/**
+ * mempool_remove_block - Removes the pending transactions made invalid by
+ *						  a Block added to the Blockchain
+ * @pool: Pointer to the mempool
+ * @block: Block just added
+ *
+ * Description: The transactions of the Block, and those spending an output
+ * spent by the Block, are deleted. Each transaction of the Block is looked
+ * up once, and each of its inputs once, the other pending transactions are
+ * not visited.
+ *
+ * Return: Number of pending transactions deleted, or -1 on failure
+*/
+int mempool_remove_block(mempool_t *pool, block_t const *block)
+{
+	int nb_removed = 0;
+	void *arg[2];
+
+	if (!pool || !block)
+		return (-1);
+
+	arg[0] = pool, arg[1] = &nb_removed;
+	if (block->transactions &&
+		block_for_each_tx(block, evict_mined, arg) == -1)
+		return (-1);
+
+	return (nb_removed);
+}
+
+/**
+ * evict_mined - Deletes a transaction of a Block from a mempool, along with
+ *				 the pending transactions spending the same outputs
+ * @node: void pointer to the transaction of the Block
+ * @idx: index of the node (unused)
+ * @arg: array holding the mempool and the number of deleted transactions
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int evict_mined(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t const *tx = node;
+	void **ptr = arg;
+	mempool_entry_t *entry = mempool_find(ptr[0], tx->id);
+
+	if (entry)
+	{
+		transaction_destroy(mempool_remove(ptr[0], entry));
+		(*(int *) ptr[1])++;
+	}
+
+	return (tx_inputs_for_each(tx, evict_spender, arg));
+	(void)idx;
+}
+
+/**
+ * evict_spender - Deletes the pending transaction spending the output
+ *				   referenced by an input of a Block
+ * @node: void pointer to the tx_in_t
+ * @idx: index of the node (unused)
+ * @arg: array holding the mempool and the number of deleted transactions
+ *
+ * Return: 0
+*/
+int evict_spender(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	mempool_entry_t *entry = mempool_spender(ptr[0], node);
+
+	if (entry)
+	{
+		transaction_destroy(mempool_remove(ptr[0], entry));
+		(*(int *) ptr[1])++;
+	}
+
+	return (0);
+	(void)idx;
+}
+
+/**
+ * mempool_revalidate - Deletes the pending transactions no longer valid
+ *						against a set of unspent outputs
+ * @pool: Pointer to the mempool
+ * @index: Hash index of the unspent outputs
+ *
+ * Description: Needed when the unspent outputs are replaced, e.g. by
+ * loading another Blockchain, every pending transaction is checked again.
+ *
+ * Return: Number of pending transactions deleted, or -1 on failure
+*/
+int mempool_revalidate(mempool_t *pool, utxo_index_t const *index)
+{
+	mempool_entry_t *entry, *next;
+	int nb_removed = 0;
+
+	if (!pool || !index)
+		return (-1);
+
+	for (entry = pool->head; entry; entry = next)
+	{
+		next = entry->next;
+		if (transaction_is_valid_indexed(entry->tx, index) != 1)
+		{
+			transaction_destroy(mempool_remove(pool, entry));
+			nb_removed++;
+		}
+	}
+
+	return (nb_removed);
+}
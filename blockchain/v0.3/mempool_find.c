@@ -0,0 +1,72 @@
+#include "blockchain.h"
+
+/**
+ * mempool_find - Finds a pending transaction by ID
+ * @pool: Pointer to the mempool
+ * @tx_id: ID of the transaction, SHA256_DIGEST_LENGTH bytes long
+ *
+ * Return: Pointer to the entry of the transaction, or NULL if not found
+*/
+mempool_entry_t *mempool_find(mempool_t const *pool, uint8_t const *tx_id)
+{
+	mempool_entry_t **slot;
+
+	if (!pool || !tx_id)
+		return (NULL);
+
+	slot = probe_get(&pool->ids, &mempool_ids_ops, tx_index_hash(tx_id),
+					 mempool_entry_is, tx_id);
+	return (slot ? *slot : NULL);
+}
+
+/**
+ * mempool_spender - Finds the pending transaction spending the output
+ *					 referenced by an input
+ * @pool: Pointer to the mempool
+ * @in: Input referencing the output
+ *
+ * Return: Pointer to the entry of the transaction, or NULL if the output
+ *		   is not spent by a pending transaction
+*/
+mempool_entry_t *mempool_spender(mempool_t const *pool, tx_in_t const *in)
+{
+	mempool_outpoint_t *slot;
+
+	if (!pool || !in)
+		return (NULL);
+
+	slot = probe_get(&pool->outpoints, &mempool_outpoints_ops,
+					 utxo_index_hash(in->tx_id, in->tx_out_hash),
+					 mempool_outpoint_is, in);
+	return (slot ? slot->entry : NULL);
+}
+
+/**
+ * mempool_id_slot - Finds the slot of a transaction ID in a mempool
+ * @pool: Pointer to the mempool, must have slots
+ * @tx_id: ID of the transaction
+ *
+ * Return: Slot of the transaction, or if it is not pending, the first
+ *		   slot it could be stored in, see probe_find()
+*/
+size_t mempool_id_slot(mempool_t const *pool, uint8_t const *tx_id)
+{
+	return (probe_find(&pool->ids, &mempool_ids_ops, tx_index_hash(tx_id),
+					   mempool_entry_is, tx_id));
+}
+
+/**
+ * mempool_outpoint_slot - Finds the slot of the output referenced by an
+ *						   input in a mempool
+ * @pool: Pointer to the mempool, must have slots
+ * @in: Input referencing the output
+ *
+ * Return: Slot of the output, or if no pending transaction spends it, the
+ *		   first slot it could be stored in, see probe_find()
+*/
+size_t mempool_outpoint_slot(mempool_t const *pool, tx_in_t const *in)
+{
+	return (probe_find(&pool->outpoints, &mempool_outpoints_ops,
+					   utxo_index_hash(in->tx_id, in->tx_out_hash),
+					   mempool_outpoint_is, in));
+}
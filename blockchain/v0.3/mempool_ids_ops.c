@@ -0,0 +1,62 @@
+#include "blockchain.h"
+
+/* Defined after */
+int mempool_entry_state(void const *slot);
+size_t mempool_entry_hash(void const *slot);
+void mempool_entry_bury(void *slot);
+
+probe_ops_t const mempool_ids_ops = {
+	sizeof(mempool_entry_t *), mempool_entry_state, mempool_entry_hash,
+	mempool_entry_bury
+};
+
+/**
+ * mempool_entry_state - Tells whether a slot of the transaction IDs of
+ *						 a mempool is used
+ * @slot: void pointer to the mempool_entry_t pointer of the slot
+ *
+ * Return: PROBE_EMPTY, PROBE_DELETED for MEMPOOL_TOMBSTONE,
+ *		   PROBE_USED otherwise
+*/
+int mempool_entry_state(void const *slot)
+{
+	mempool_entry_t const *entry = *(mempool_entry_t * const *) slot;
+
+	if (!entry)
+		return (PROBE_EMPTY);
+	return (entry == MEMPOOL_TOMBSTONE ? PROBE_DELETED : PROBE_USED);
+}
+
+/**
+ * mempool_entry_hash - Computes the hash table key of the entry of a slot
+ * @slot: void pointer to the used mempool_entry_t pointer
+ *
+ * Return: Hash table key, see tx_index_hash()
+*/
+size_t mempool_entry_hash(void const *slot)
+{
+	return (tx_index_hash((*(mempool_entry_t * const *) slot)->tx->id));
+}
+
+/**
+ * mempool_entry_bury - Marks the slot of a removed entry
+ * @slot: void pointer to the used mempool_entry_t pointer
+*/
+void mempool_entry_bury(void *slot)
+{
+	*(mempool_entry_t **) slot = MEMPOOL_TOMBSTONE;
+}
+
+/**
+ * mempool_entry_is - Checks whether the transaction of the entry of a slot
+ *					  has a given ID
+ * @slot: void pointer to the used mempool_entry_t pointer
+ * @key: ID to look for, SHA256_DIGEST_LENGTH bytes long
+ *
+ * Return: 1 if the transaction has this ID, 0 otherwise
+*/
+int mempool_entry_is(void const *slot, void const *key)
+{
+	return (!memcmp((*(mempool_entry_t * const *) slot)->tx->id, key,
+					SHA256_DIGEST_LENGTH));
+}
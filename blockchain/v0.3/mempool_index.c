@@ -0,0 +1,79 @@
+#include "blockchain.h"
+
+/**
+ * mempool_index_input - Records the output spent by an input of a pending
+ *						 transaction
+ * @node: void pointer to the tx_in_t
+ * @idx: index of the node (unused)
+ * @arg: array holding the mempool, with room for the input, and the entry
+ *		 of the transaction
+ *
+ * Return: 0 on success, -1 if the output is already spent by a pending
+ *		   transaction
+*/
+int mempool_index_input(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	mempool_t *pool = ptr[0];
+	mempool_outpoint_t *slot;
+	size_t i;
+
+	i = mempool_outpoint_slot(pool, node);
+	slot = probe_at(&pool->outpoints, &mempool_outpoints_ops, i);
+	if (mempool_outpoints_ops.state(slot) == PROBE_USED)
+		return (-1);
+
+	slot = probe_claim(&pool->outpoints, &mempool_outpoints_ops, i);
+	slot->in = node, slot->entry = ptr[1];
+	return (0);
+	(void)idx;
+}
+
+/**
+ * mempool_unindex_input - Forgets the output spent by an input of a pending
+ *						   transaction
+ * @node: void pointer to the tx_in_t
+ * @idx: index of the node (unused)
+ * @arg: array holding the mempool and the entry of the transaction, only
+ *		 the outputs recorded for this entry are forgotten
+ *
+ * Return: 0
+*/
+int mempool_unindex_input(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	mempool_t *pool = ptr[0];
+	mempool_outpoint_t *slot;
+	size_t i;
+
+	if (!pool->outpoints.capacity)
+		return (0);
+
+	i = mempool_outpoint_slot(pool, node);
+	slot = probe_at(&pool->outpoints, &mempool_outpoints_ops, i);
+	if (mempool_outpoints_ops.state(slot) == PROBE_USED &&
+		slot->entry == ptr[1])
+		probe_release(&pool->outpoints, &mempool_outpoints_ops, i);
+	return (0);
+	(void)idx;
+}
+
+/**
+ * mempool_reserve - Makes room in the tables of a mempool for one more
+ *					 transaction
+ * @pool: Pointer to the mempool
+ * @nb_outpoints: Number of inputs of the transaction
+ *
+ * Description: Adding the transaction can then no longer fail.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int mempool_reserve(mempool_t *pool, size_t nb_outpoints)
+{
+	if (probe_reserve(&pool->ids, &mempool_ids_ops, 1) == -1 ||
+		probe_reserve(&pool->outpoints, &mempool_outpoints_ops,
+					  nb_outpoints) == -1)
+		return (-1);
+
+	return (0);
+}
@@ -0,0 +1,73 @@
+#include "blockchain.h"
+
+/* Defined after */
+int mempool_outpoint_state(void const *slot);
+size_t mempool_outpoint_hash(void const *slot);
+void mempool_outpoint_bury(void *slot);
+
+probe_ops_t const mempool_outpoints_ops = {
+	sizeof(mempool_outpoint_t), mempool_outpoint_state, mempool_outpoint_hash,
+	mempool_outpoint_bury
+};
+
+/**
+ * mempool_outpoint_state - Tells whether a slot of the spent outputs of
+ *							a mempool is used
+ * @slot: void pointer to the mempool_outpoint_t
+ *
+ * Return: PROBE_EMPTY, PROBE_DELETED if the entry spending the output was
+ *		   removed, PROBE_USED otherwise
+*/
+int mempool_outpoint_state(void const *slot)
+{
+	mempool_outpoint_t const *outpoint = slot;
+
+	if (!outpoint->in)
+		return (PROBE_EMPTY);
+	return (outpoint->entry == MEMPOOL_TOMBSTONE ? PROBE_DELETED : PROBE_USED);
+}
+
+/**
+ * mempool_outpoint_hash - Computes the hash table key of the output spent
+ *						   by the input of a slot
+ * @slot: void pointer to the used mempool_outpoint_t
+ *
+ * Return: Hash table key, see utxo_index_hash()
+*/
+size_t mempool_outpoint_hash(void const *slot)
+{
+	tx_in_t const *in = ((mempool_outpoint_t const *) slot)->in;
+
+	return (utxo_index_hash(in->tx_id, in->tx_out_hash));
+}
+
+/**
+ * mempool_outpoint_bury - Marks the slot of an output no longer spent
+ * @slot: void pointer to the used mempool_outpoint_t
+ *
+ * Description: The slot keeps pointing to the input, which is never read
+ * again.
+*/
+void mempool_outpoint_bury(void *slot)
+{
+	((mempool_outpoint_t *) slot)->entry = MEMPOOL_TOMBSTONE;
+}
+
+/**
+ * mempool_outpoint_is - Checks whether the input of a slot spends the
+ *						 output referenced by another input
+ * @slot: void pointer to the used mempool_outpoint_t
+ * @key: void pointer to the tx_in_t referencing the output
+ *
+ * Return: 1 if both inputs reference the same output, 0 otherwise
+*/
+int mempool_outpoint_is(void const *slot, void const *key)
+{
+	tx_in_t const *other = ((mempool_outpoint_t const *) slot)->in;
+	tx_in_t const *in = key;
+
+	return (!memcmp(other->tx_out_hash, in->tx_out_hash,
+					SHA256_DIGEST_LENGTH) &&
+			!memcmp(other->tx_id, in->tx_id, SHA256_DIGEST_LENGTH) &&
+			!memcmp(other->block_hash, in->block_hash, SHA256_DIGEST_LENGTH));
+}
@@ -0,0 +1,78 @@
+#include "blockchain.h"
+
+/* Defined after */
+int mempool_spends(mempool_t const *pool, utxo_t const *utxo);
+
+/**
+ * mempool_transaction_create - Creates a transaction spending only the
+ *								outputs no pending transaction spends
+ * @pool: Pointer to the mempool
+ * @sender: contains the private key of the transaction sender
+ * @receiver: contains the public key of the receiver
+ * @amount: amount to send
+ * @index: hash index of all the unspent outputs (utxo) to date
+ *
+ * Description: Same as transaction_create_indexed(), but the outputs of
+ * sender already spent by a pending transaction are left out, so that
+ * mempool_add() does not reject the transaction as a double spend.
+ *
+ * Return: pointer to the created transaction upon success,
+ * or NULL upon failure (e.g. the outputs left cannot cover amount)
+*/
+transaction_t *mempool_transaction_create(mempool_t const *pool,
+										  EC_KEY const *sender,
+										  EC_KEY const *receiver,
+										  uint32_t amount,
+										  utxo_index_t const *index)
+{
+	uint8_t sender_pub[EC_PUB_LEN];
+	utxo_address_t *address;
+	transaction_t *transaction = NULL;
+	utxo_t **available, **selected;
+	size_t i, nb_available = 0, nb_selected = 0;
+
+	if (!pool || !sender || !receiver || !index ||
+		!ec_to_pub(sender, sender_pub))
+		return (NULL);
+
+	address = utxo_index_address(index, sender_pub);
+	if (!address || !address->size)
+		return (NULL);
+
+	available = malloc(2 * address->size * sizeof(*available));
+	if (!available)
+		return (NULL);
+	selected = available + address->size;
+	for (i = 0; i < address->size; i++)
+	{
+		if (!mempool_spends(pool, address->utxos[i]))
+			available[nb_available++] = address->utxos[i];
+	}
+
+	if (nb_available)
+		nb_selected = coin_select_default(available, nb_available, amount,
+										  selected);
+	if (nb_selected)
+		transaction = transaction_assemble(sender, receiver, amount, selected,
+										   nb_selected, NULL, index);
+	free(available);
+	return (transaction);
+}
+
+/**
+ * mempool_spends - Checks whether a pending transaction spends an output
+ * @pool: Pointer to the mempool
+ * @utxo: Unspent output to look for
+ *
+ * Return: 1 if a pending transaction spends utxo, 0 otherwise
+*/
+int mempool_spends(mempool_t const *pool, utxo_t const *utxo)
+{
+	tx_in_t in;
+
+	memcpy(in.block_hash, utxo->block_hash, SHA256_DIGEST_LENGTH);
+	memcpy(in.tx_id, utxo->tx_id, SHA256_DIGEST_LENGTH);
+	memcpy(in.tx_out_hash, utxo->out.hash, SHA256_DIGEST_LENGTH);
+
+	return (mempool_spender(pool, &in) != NULL);
+}
@@ -0,0 +1,90 @@
+#include "blockchain.h"
+
+/**
+ * block_set_version - Sets the version of a Block
+ * @block: Pointer to the Block, not mined yet
+ * @version: BLOCK_VERSION_LIST or BLOCK_VERSION_MERKLE
+ *
+ * Description: A Merkle Block keeps the Merkle tree of its transactions,
+ * updated by block_merkle_sync() for the transactions added since its last
+ * call. Blocks created after it by block_create() get the same version.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int block_set_version(block_t *block, uint8_t version)
+{
+	if (!block || version > BLOCK_VERSION_MAX)
+		return (-1);
+
+	if (version == BLOCK_VERSION_MERKLE && !block->merkle)
+	{
+		block->merkle = calloc(1, sizeof(*block->merkle));
+		if (!block->merkle)
+			return (-1);
+	}
+	else if (version != BLOCK_VERSION_MERKLE && block->merkle)
+	{
+		merkle_tree_clear(block->merkle);
+		free(block->merkle);
+		block->merkle = NULL;
+	}
+
+	block->version = version;
+	return (0);
+}
+
+/**
+ * block_merkle_root - Computes the Merkle root of the transactions of
+ *					   a Block
+ * @block: Pointer to the Block
+ * @root: Buffer receiving the root
+ *
+ * Return: Pointer to root, or NULL on failure
+*/
+uint8_t *block_merkle_root(block_t const *block,
+						   uint8_t root[SHA256_DIGEST_LENGTH])
+{
+	merkle_tree_t tmp;
+	merkle_tree_t const *tree;
+
+	if (!block || !root)
+		return (NULL);
+
+	tree = block_merkle_tree(block, &tmp);
+	if (!tree)
+		return (NULL);
+
+	merkle_tree_root(tree, root);
+	if (tree == &tmp)
+		merkle_tree_clear(&tmp);
+	return (root);
+}
+
+/**
+ * block_merkle_tree - Gets the Merkle tree of the transactions of a Block
+ * @block: Pointer to the Block
+ * @tmp: Tree the transactions are hashed into if the tree of the Block is
+ *		 missing or out of date, to be cleared by the caller if it is
+ *		 returned
+ *
+ * Description: The Block is only read, so several threads can call this
+ * function on the same Block. The tree it keeps is used as is if it
+ * matches its transactions, see block_merkle_sync().
+ *
+ * Return: Pointer to the tree of the Block, or to tmp, or NULL on failure
+*/
+merkle_tree_t const *block_merkle_tree(block_t const *block,
+									   merkle_tree_t *tmp)
+{
+	if (block->merkle && merkle_tree_matches(block->merkle, block))
+		return (block->merkle);
+
+	memset(tmp, 0, sizeof(*tmp));
+	if (merkle_tree_sync(tmp, block) == -1)
+	{
+		merkle_tree_clear(tmp);
+		return (NULL);
+	}
+
+	return (tmp);
+}
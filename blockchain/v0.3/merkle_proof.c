@@ -0,0 +1,110 @@
+#include "blockchain.h"
+
+/**
+ * merkle_hash_pair - Hashes two nodes of a Merkle tree into their parent
+ * @left: Left node
+ * @right: Right node
+ * @parent: Buffer receiving the parent
+ *
+ * Description: The nodes are prefixed with MERKLE_NODE_PREFIX, so that
+ * a node can never be taken for a transaction ID, whose hashed bytes are
+ * a multiple of SHA256_DIGEST_LENGTH long.
+ *
+ * Return: Pointer to parent
+*/
+uint8_t *merkle_hash_pair(uint8_t const *left, uint8_t const *right,
+						  uint8_t parent[SHA256_DIGEST_LENGTH])
+{
+	int8_t buf[1 + 2 * SHA256_DIGEST_LENGTH];
+
+	buf[0] = MERKLE_NODE_PREFIX;
+	memcpy(buf + 1, left, SHA256_DIGEST_LENGTH);
+	memcpy(buf + 1 + SHA256_DIGEST_LENGTH, right, SHA256_DIGEST_LENGTH);
+	return (sha256(buf, sizeof(buf), parent));
+}
+
+/**
+ * block_merkle_proof - Builds the proof that a transaction is part of
+ *						a Merkle Block
+ * @block: Pointer to the Block
+ * @pos: Position of the transaction in the Block
+ * @len: Address at which to store the number of hashes of the proof
+ *
+ * Description: The proof is the sibling of each node on the path from the
+ * transaction to the root, from the bottom up, skipping the levels where
+ * the node has no sibling. It is checked by merkle_proof_verify(), with
+ * no other part of the Block than its Merkle root.
+ *
+ * Return: Pointer to the allocated hashes, or NULL if pos is out of range
+ *		   or on failure
+*/
+uint8_t *block_merkle_proof(block_t const *block, uint32_t pos,
+							uint32_t *len)
+{
+	merkle_tree_t tmp;
+	merkle_tree_t const *tree;
+	uint8_t *proof = NULL;
+	uint32_t level, sibling;
+
+	if (!block || !len)
+		return (NULL);
+
+	tree = block_merkle_tree(block, &tmp);
+	if (tree && pos < tree->sizes[0])
+		proof = malloc((tree->depth + 1) * SHA256_DIGEST_LENGTH);
+
+	*len = 0;
+	for (level = 0; proof && level < tree->depth; level++, pos /= 2)
+	{
+		sibling = pos ^ 1;
+		if (sibling >= tree->sizes[level])
+			continue;
+		memcpy(proof + *len * SHA256_DIGEST_LENGTH,
+			   tree->levels[level] + (size_t)sibling * SHA256_DIGEST_LENGTH,
+			   SHA256_DIGEST_LENGTH);
+		(*len)++;
+	}
+
+	if (tree == &tmp)
+		merkle_tree_clear(&tmp);
+	return (proof);
+}
+
+/**
+ * merkle_proof_verify - Checks that a transaction is part of a Block
+ * @root: Merkle root of the Block
+ * @tx_id: ID of the transaction
+ * @pos: Position of the transaction in the Block
+ * @nb_leaves: Number of transactions in the Block
+ * @proof: Hashes built by block_merkle_proof()
+ * @len: Number of hashes in proof
+ *
+ * Return: 1 if the proof leads from tx_id to root, 0 otherwise
+*/
+int merkle_proof_verify(uint8_t const root[SHA256_DIGEST_LENGTH],
+						uint8_t const *tx_id, uint32_t pos,
+						uint32_t nb_leaves, uint8_t const *proof,
+						uint32_t len)
+{
+	uint8_t node[SHA256_DIGEST_LENGTH];
+	uint32_t used = 0;
+
+	if (!root || !tx_id || (len && !proof) || pos >= nb_leaves)
+		return (0);
+
+	memcpy(node, tx_id, SHA256_DIGEST_LENGTH);
+	for (; nb_leaves > 1; nb_leaves = (nb_leaves + 1) / 2, pos /= 2)
+	{
+		if ((pos ^ 1) >= nb_leaves)
+			continue;
+		if (used == len)
+			return (0);
+		if (pos & 1)
+			merkle_hash_pair(proof + used * SHA256_DIGEST_LENGTH, node, node);
+		else
+			merkle_hash_pair(node, proof + used * SHA256_DIGEST_LENGTH, node);
+		used++;
+	}
+
+	return (used == len && !memcmp(node, root, SHA256_DIGEST_LENGTH));
+}
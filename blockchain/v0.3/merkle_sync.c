@@ -0,0 +1,136 @@
+#include "blockchain.h"
+
+/* Defined after */
+int sync_leaf(llist_node_t node, unsigned int idx, void *arg);
+int match_leaf(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * block_merkle_sync - Brings the Merkle tree kept by a Block up to date
+ * @block: Pointer to the Block
+ *
+ * Description: Only the transactions added or changed since the last call
+ * are hashed. Must be called by the owner of the Block once its
+ * transactions are set, before it is shared with other threads.
+ *
+ * Return: 0 on success or if the Block keeps no tree, -1 on failure
+*/
+int block_merkle_sync(block_t *block)
+{
+	if (!block)
+		return (-1);
+	if (!block->merkle)
+		return (0);
+
+	if (merkle_tree_sync(block->merkle, block) == -1)
+	{
+		merkle_tree_clear(block->merkle);
+		return (-1);
+	}
+
+	return (0);
+}
+
+/**
+ * merkle_tree_sync - Updates a Merkle tree after the transactions of
+ *					  a Block
+ * @tree: Pointer to the tree
+ * @block: Pointer to the Block
+ *
+ * Description: The leaves are compared with the transaction IDs, from
+ * the first one. The leaves from the first mismatch on are replaced, and
+ * only the nodes above them are hashed again.
+ *
+ * Return: 0 on success, -1 on failure, in which case the tree must be
+ *		   cleared
+*/
+int merkle_tree_sync(merkle_tree_t *tree, block_t const *block)
+{
+	uint32_t first = (uint32_t)-1, nb_leaves = 0;
+	int nb_transactions = llist_size(block->transactions);
+	void *arg[2];
+
+	arg[0] = tree, arg[1] = &first;
+	if (nb_transactions > 0)
+	{
+		nb_leaves = nb_transactions;
+		if (block_for_each_tx(block, sync_leaf, arg) == -1)
+			return (-1);
+	}
+
+	/* Transactions removed from the end of the list */
+	if (tree->sizes[0] > nb_leaves)
+	{
+		tree->sizes[0] = nb_leaves;
+		if (first > nb_leaves)
+			first = nb_leaves;
+	}
+
+	if (first == (uint32_t)-1)
+		return (0);
+	return (merkle_tree_update(tree, first));
+}
+
+/**
+ * sync_leaf - Checks a leaf of a Merkle tree against a transaction ID,
+ *			   and replaces it and every leaf after it on a mismatch
+ * @node: void pointer to the transaction
+ * @idx: index of the transaction in the Block
+ * @arg: array holding the tree, and the index of the first leaf replaced
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int sync_leaf(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t const *tx = node;
+	void **ptr = arg;
+	merkle_tree_t *tree = ptr[0];
+	uint32_t *first = ptr[1];
+
+	if (idx < tree->sizes[0])
+	{
+		if (!memcmp(tree->levels[0] + (size_t)idx * SHA256_DIGEST_LENGTH,
+					tx->id, SHA256_DIGEST_LENGTH))
+			return (0);
+		tree->sizes[0] = idx;
+	}
+
+	if (*first > idx)
+		*first = idx;
+	return (merkle_tree_push(tree, tx->id));
+}
+
+/**
+ * merkle_tree_matches - Checks whether a Merkle tree is up to date with
+ *						 the transactions of a Block
+ * @tree: Pointer to the tree
+ * @block: Pointer to the Block
+ *
+ * Return: 1 if the leaves are the transaction IDs, in order, 0 otherwise
+*/
+int merkle_tree_matches(merkle_tree_t const *tree, block_t const *block)
+{
+	int nb_transactions = llist_size(block->transactions);
+
+	if (nb_transactions < 0 || tree->sizes[0] != (uint32_t)nb_transactions)
+		return (0);
+
+	return (nb_transactions == 0 ||
+			block_for_each_tx(block, match_leaf, (void *)tree) == 0);
+}
+
+/**
+ * match_leaf - Compares a leaf of a Merkle tree with a transaction ID
+ * @node: void pointer to the transaction
+ * @idx: index of the transaction in the Block
+ * @arg: void pointer to the tree
+ *
+ * Return: 0 if they match, -1 otherwise
+*/
+int match_leaf(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t const *tx = node;
+	merkle_tree_t const *tree = arg;
+
+	return (memcmp(tree->levels[0] + (size_t)idx * SHA256_DIGEST_LENGTH,
+				   tx->id, SHA256_DIGEST_LENGTH) ? -1 : 0);
+}
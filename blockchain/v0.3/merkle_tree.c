@@ -0,0 +1,143 @@
+#include "blockchain.h"
+
+/* Defined after */
+int merkle_level_reserve(merkle_tree_t *tree, uint32_t level, uint32_t size);
+
+/**
+ * merkle_tree_push - Appends a leaf to a Merkle tree
+ * @tree: Pointer to the tree
+ * @hash: Hash of the leaf
+ *
+ * Description: Only the leaves are changed, merkle_tree_update() must
+ * then be called before the root is read.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int merkle_tree_push(merkle_tree_t *tree, uint8_t const *hash)
+{
+	if (merkle_level_reserve(tree, 0, tree->sizes[0] + 1) == -1)
+		return (-1);
+
+	memcpy(tree->levels[0] + (size_t)tree->sizes[0] * SHA256_DIGEST_LENGTH,
+		   hash, SHA256_DIGEST_LENGTH);
+	tree->sizes[0]++;
+	return (0);
+}
+
+/**
+ * merkle_tree_update - Recomputes the nodes of a Merkle tree above the
+ *						leaves that changed
+ * @tree: Pointer to the tree
+ * @first: Index of the first leaf that changed, the leaves before it being
+ *		   unchanged since the last update
+ *
+ * Description: Only the nodes on the paths from the changed leaves to the
+ * root are hashed again: appending a leaf to a tree of n leaves costs
+ * about log2(n) hashes.
+ *
+ * Return: 0 on success, -1 on failure, in which case the tree must be
+ *		   cleared
+*/
+int merkle_tree_update(merkle_tree_t *tree, uint32_t first)
+{
+	uint32_t level, size, i;
+	uint8_t *below, *nodes;
+
+	/* The parent of the last leaf changes when leaves are removed */
+	if (tree->sizes[0] && first >= tree->sizes[0])
+		first = tree->sizes[0] - 1;
+
+	for (level = 0; tree->sizes[level] > 1; level++)
+	{
+		size = (tree->sizes[level] + 1) / 2;
+		if (level + 1 >= MERKLE_MAX_LEVELS ||
+			merkle_level_reserve(tree, level + 1, size) == -1)
+			return (-1);
+
+		below = tree->levels[level], nodes = tree->levels[level + 1];
+		for (first /= 2, i = first; i < size; i++)
+		{
+			if (2 * i + 1 < tree->sizes[level])
+				merkle_hash_pair(below + 2 * i * SHA256_DIGEST_LENGTH,
+								 below + (2 * i + 1) * SHA256_DIGEST_LENGTH,
+								 nodes + i * SHA256_DIGEST_LENGTH);
+			else
+				memcpy(nodes + i * SHA256_DIGEST_LENGTH,
+					   below + 2 * i * SHA256_DIGEST_LENGTH,
+					   SHA256_DIGEST_LENGTH);
+		}
+		tree->sizes[level + 1] = size;
+	}
+
+	/* Levels left above the root after leaves were removed */
+	tree->depth = level;
+	for (level++; level < MERKLE_MAX_LEVELS && tree->sizes[level]; level++)
+		tree->sizes[level] = 0;
+
+	return (0);
+}
+
+/**
+ * merkle_level_reserve - Makes room for a number of nodes in a level of
+ *						  a Merkle tree
+ * @tree: Pointer to the tree
+ * @level: Level to grow
+ * @size: Number of nodes the level must be able to hold
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int merkle_level_reserve(merkle_tree_t *tree, uint32_t level, uint32_t size)
+{
+	uint32_t capacity = tree->capacities[level];
+	uint8_t *nodes;
+
+	if (size <= capacity)
+		return (0);
+
+	if (!capacity)
+		capacity = MERKLE_MIN_CAPACITY;
+	while (capacity < size)
+		capacity *= 2;
+	nodes = realloc(tree->levels[level],
+					(size_t)capacity * SHA256_DIGEST_LENGTH);
+	if (!nodes)
+		return (-1);
+
+	tree->levels[level] = nodes;
+	tree->capacities[level] = capacity;
+	return (0);
+}
+
+/**
+ * merkle_tree_root - Reads the root of a Merkle tree
+ * @tree: Pointer to the tree, up to date
+ * @root: Buffer receiving the root, zeroed if the tree has no leaf
+ *
+ * Return: Pointer to root
+*/
+uint8_t *merkle_tree_root(merkle_tree_t const *tree,
+						  uint8_t root[SHA256_DIGEST_LENGTH])
+{
+	if (!tree->sizes[0])
+		memset(root, 0, SHA256_DIGEST_LENGTH);
+	else
+		memcpy(root, tree->levels[tree->depth], SHA256_DIGEST_LENGTH);
+
+	return (root);
+}
+
+/**
+ * merkle_tree_clear - Frees the nodes of a Merkle tree, leaving it empty
+ * @tree: Pointer to the tree, not freed
+*/
+void merkle_tree_clear(merkle_tree_t *tree)
+{
+	uint32_t level;
+
+	if (!tree)
+		return;
+
+	for (level = 0; level < MERKLE_MAX_LEVELS; level++)
+		free(tree->levels[level]);
+	memset(tree, 0, sizeof(*tree));
+}
@@ -0,0 +1,96 @@
+#include <stdio.h>
+
+#include "blockchain.h"
+
+/**
+ * _new_block - Creates a Block holding a coinbase transaction
+ *
+ * @blockchain: Pointer to the Blockchain the Block follows the tail of
+ * @miner: Key of the miner
+ *
+ * Return: Pointer to the Block, not mined yet
+ */
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner)
+{
+	block_t *prev = llist_get_tail(blockchain->chain), *block;
+
+	block = block_create(prev, (int8_t *)"Block", 5);
+	block->info.difficulty = 4;
+	llist_add_node(block->transactions,
+		coinbase_create(miner, block->info.index), ADD_NODE_FRONT);
+	return (block);
+}
+
+/**
+ * _mine_block - Mines a Block and appends it to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @block: Block to mine, following the tail of blockchain
+ *
+ * Return: Pointer to the Block, or NULL if it was rejected and destroyed
+ */
+block_t *_mine_block(blockchain_t *blockchain, block_t *block)
+{
+	block_mine(block);
+	if (block_apply(blockchain, block, 1) == -1)
+	{
+		block_destroy(block);
+		return (NULL);
+	}
+	return (block);
+}
+
+/**
+ * _mine - Appends a mined Block to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @miner: Key of the miner
+ * @receiver: Key receiving a transaction from the miner, or NULL
+ */
+void _mine(blockchain_t *blockchain, EC_KEY *miner, EC_KEY *receiver)
+{
+	block_t *block = _new_block(blockchain, miner);
+
+	if (receiver)
+		llist_add_node(block->transactions, transaction_create_indexed(miner,
+			receiver, 10, blockchain->unspent_index), ADD_NODE_REAR);
+	_mine_block(blockchain, block);
+}
+
+/**
+ * _mine_tx - Appends a mined Block holding a transaction to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @miner: Key of the miner
+ * @tx: Transaction added after the coinbase transaction, or NULL
+ *
+ * Return: Pointer to the Block, or NULL if it was rejected and destroyed
+ */
+block_t *_mine_tx(blockchain_t *blockchain, EC_KEY *miner, transaction_t *tx)
+{
+	block_t *block = _new_block(blockchain, miner);
+
+	if (tx)
+		llist_add_node(block->transactions, tx, ADD_NODE_REAR);
+	return (_mine_block(blockchain, block));
+}
+
+/**
+ * _same_files - Compares two files byte by byte
+ *
+ * @a: Path to the first file
+ * @b: Path to the second file
+ *
+ * Return: 1 if both files hold the same bytes, 0 otherwise
+ */
+int _same_files(char const *a, char const *b)
+{
+	FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+	int ca, cb;
+
+	do {
+		ca = fgetc(fa), cb = fgetc(fb);
+	} while (ca == cb && ca != EOF);
+	fclose(fa), fclose(fb);
+	return (ca == cb);
+}
@@ -0,0 +1,102 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner);
+
+/**
+ * _balance - Computes the balance of a key from the index
+ */
+static uint64_t _balance(blockchain_t *blockchain, EC_KEY *key)
+{
+	uint8_t pub[EC_PUB_LEN];
+	utxo_address_t *address;
+
+	ec_to_pub(key, pub);
+	address = utxo_index_address(blockchain->unspent_index, pub);
+	return (address ? address->balance : 0);
+}
+
+/**
+ * _is - Identifies a node by address
+ */
+static int _is(llist_node_t node, void *arg)
+{
+	return (node == arg);
+}
+
+/**
+ * _apply - Mines a Block, applies it and prints the resulting state
+ */
+static void _apply(blockchain_t *blockchain, block_t *block, EC_KEY *wallet)
+{
+	int ret;
+
+	block_mine(block);
+	ret = block_apply(blockchain, block, 2);
+	if (!wallet)
+		return;
+	printf("block_apply: %d, chain: %d, unspent: %d, indexed: %lu, "
+		"balance: %lu\n", ret, llist_size(blockchain->chain),
+		llist_size(blockchain->unspent),
+		blockchain->unspent_index->outputs.size, _balance(blockchain, wallet));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallet, *alice;
+	transaction_t *tx;
+	block_t *block;
+
+	blockchain = blockchain_create();
+	wallet = ec_create(), alice = ec_create();
+
+	printf("Coinbase:\n");
+	_apply(blockchain, _new_block(blockchain, wallet), wallet);
+	_apply(blockchain, _new_block(blockchain, wallet), wallet);
+
+	printf("Spend:\n");
+	tx = transaction_create_indexed(wallet, alice, 60,
+		blockchain->unspent_index);
+	block = _new_block(blockchain, alice);
+	llist_add_node(block->transactions, tx, ADD_NODE_REAR);
+	_apply(blockchain, block, wallet);
+
+	printf("Spent again:\n");
+	block = _new_block(blockchain, alice);
+	llist_add_node(block->transactions, tx, ADD_NODE_REAR);
+	_apply(blockchain, block, wallet);
+	llist_remove_node(block->transactions, _is, tx, 0, NULL);
+	block_destroy(block);
+
+	/* Coinbase outputs are appended in place, then spent at once */
+	printf("Many inputs:\n");
+	while (llist_size(blockchain->chain) < 45)
+		_apply(blockchain, _new_block(blockchain, wallet), NULL);
+	tx = transaction_create_indexed(wallet, alice, 1900,
+		blockchain->unspent_index);
+	block = _new_block(blockchain, alice);
+	llist_add_node(block->transactions, tx, ADD_NODE_REAR);
+	printf("inputs: %d\n", llist_size(tx->inputs));
+	_apply(blockchain, block, wallet);
+
+	printf("Unmined:\n");
+	block = _new_block(blockchain, wallet);
+	printf("block_apply: %d, chain: %d, unspent: %d\n",
+		block_apply(blockchain, block, 1), llist_size(blockchain->chain),
+		llist_size(blockchain->unspent));
+	block_destroy(block);
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice);
+
+	return (EXIT_SUCCESS);
+}
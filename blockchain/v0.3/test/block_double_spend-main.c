@@ -0,0 +1,66 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner);
+
+/**
+ * _check - Validates a Block in every mode
+ */
+static void _check(blockchain_t *blockchain, block_t *block)
+{
+	block_t *prev = llist_get_tail(blockchain->chain);
+
+	block_mine(block);
+	printf("block_is_valid: %d\n", block_is_valid(block, prev,
+		blockchain->unspent));
+	printf("block_is_valid_indexed: %d\n", block_is_valid_indexed(block, prev,
+		blockchain->unspent_index));
+	printf("block_is_valid_parallel: %d\n", block_is_valid_parallel(block,
+		prev, blockchain->unspent_index, 2));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallet, *alice, *bob;
+	transaction_t *to_alice, *to_bob;
+	block_t *block;
+
+	blockchain = blockchain_create();
+	wallet = ec_create(), alice = ec_create(), bob = ec_create();
+
+	block = _new_block(blockchain, wallet);
+	block_mine(block);
+	llist_add_node(blockchain->chain, block, ADD_NODE_REAR);
+	blockchain->unspent = update_unspent_indexed(block->transactions,
+		block->hash, blockchain->unspent, blockchain->unspent_index);
+
+	/* Both transactions spend the only coin of wallet */
+	to_alice = transaction_create_indexed(wallet, alice, 10,
+		blockchain->unspent_index);
+	to_bob = transaction_create_indexed(wallet, bob, 20,
+		blockchain->unspent_index);
+
+	printf("One spend:\n");
+	block = _new_block(blockchain, bob);
+	llist_add_node(block->transactions, to_alice, ADD_NODE_REAR);
+	_check(blockchain, block);
+
+	printf("Double spend:\n");
+	llist_add_node(block->transactions, to_bob, ADD_NODE_REAR);
+	_check(blockchain, block);
+
+	block_destroy(block);
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice), EC_KEY_free(bob);
+
+	return (EXIT_SUCCESS);
+}
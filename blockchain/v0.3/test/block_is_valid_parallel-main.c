@@ -0,0 +1,87 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner);
+
+#define NB_WALLETS 16
+
+/**
+ * _apply_block - Mines a Block and adds it to the Blockchain
+ */
+static void _apply_block(blockchain_t *blockchain, block_t *block)
+{
+	block_mine(block);
+	llist_add_node(blockchain->chain, block, ADD_NODE_REAR);
+	blockchain->unspent = update_unspent_indexed(block->transactions,
+		block->hash, blockchain->unspent, blockchain->unspent_index);
+}
+
+/**
+ * _check - Validates a Block with several numbers of threads
+ */
+static void _check(blockchain_t *blockchain, block_t *block)
+{
+	unsigned int const nthreads[] = {1, 2, 4, 8, 0};
+	block_t *prev = llist_get_tail(blockchain->chain);
+	size_t i;
+
+	for (i = 0; i < sizeof(nthreads) / sizeof(*nthreads); i++)
+	{
+		printf("%u threads: %d\n", nthreads[i], block_is_valid_parallel(block,
+			prev, blockchain->unspent_index, nthreads[i]));
+	}
+	printf("Sequential: %d\n", block_is_valid(block, prev,
+		blockchain->unspent));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallets[NB_WALLETS], *receiver;
+	transaction_t *transaction;
+	tx_in_t *in;
+	block_t *block;
+	int i;
+
+	blockchain = blockchain_create();
+	receiver = ec_create();
+	for (i = 0; i < NB_WALLETS; i++)
+	{
+		wallets[i] = ec_create();
+		_apply_block(blockchain, _new_block(blockchain, wallets[i]));
+	}
+
+	/* Every wallet sends its coins in the same Block */
+	block = _new_block(blockchain, receiver);
+	for (i = 0; i < NB_WALLETS; i++)
+	{
+		transaction = transaction_create_indexed(wallets[i], receiver, 42,
+			blockchain->unspent_index);
+		llist_add_node(block->transactions, transaction, ADD_NODE_REAR);
+	}
+	block_mine(block);
+	printf("Valid Block:\n");
+	_check(blockchain, block);
+
+	/* Corrupt one signature */
+	in = llist_get_head(transaction->inputs);
+	in->sig.sig[10] ^= 1;
+	printf("Invalid signature:\n");
+	_check(blockchain, block);
+
+	block_destroy(block);
+	blockchain_destroy(blockchain);
+	for (i = 0; i < NB_WALLETS; i++)
+		EC_KEY_free(wallets[i]);
+	EC_KEY_free(receiver);
+
+	return (EXIT_SUCCESS);
+}
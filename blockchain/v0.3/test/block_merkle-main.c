@@ -0,0 +1,218 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner);
+block_t *_mine_block(blockchain_t *blockchain, block_t *block);
+
+/**
+ * _mine_version - Appends a mined Block of a given version to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @miner: Key of the miner
+ * @version: Version of the Block
+ * @nb_tx: Number of transactions sent by the miner to itself, 0 or 1
+ */
+static void _mine_version(blockchain_t *blockchain, EC_KEY *miner,
+	uint8_t version, int nb_tx)
+{
+	block_t *block = _new_block(blockchain, miner);
+	uint32_t index = block->info.index;
+	int i;
+
+	block_set_version(block, version);
+	for (i = 0; i < nb_tx; i++)
+		llist_add_node(block->transactions, transaction_create_indexed(miner,
+			miner, 1, blockchain->unspent_index), ADD_NODE_REAR);
+	if (!_mine_block(blockchain, block))
+		printf("Block %u rejected\n", index);
+}
+
+/**
+ * _rebuilt_root - Computes the Merkle root of a Block from scratch
+ *
+ * @block: Pointer to the Block
+ * @root: Buffer receiving the root
+ */
+static void _rebuilt_root(block_t const *block, uint8_t *root)
+{
+	block_t copy = *block;
+
+	copy.merkle = NULL;
+	block_merkle_root(&copy, root);
+}
+
+/**
+ * _check_tree - Grows the transactions of a Block one at a time, checking
+ * its Merkle root and proofs after each one
+ *
+ * @miner: Key of the miner
+ */
+static void _check_tree(EC_KEY *miner)
+{
+	block_t *block = block_create(&_genesis, NULL, 0);
+	uint8_t root[SHA256_DIGEST_LENGTH], rebuilt[SHA256_DIGEST_LENGTH];
+	uint8_t *proof;
+	uint32_t len, pos;
+	int i, same = 1, proven = 1, tampered = 0;
+	transaction_t *tx;
+	llist_t *list;
+
+	block_set_version(block, BLOCK_VERSION_MERKLE);
+	for (i = 0; i < 37; i++)
+	{
+		llist_add_node(block->transactions, coinbase_create(miner, i),
+			ADD_NODE_REAR);
+		block_merkle_sync(block);
+		block_merkle_root(block, root);
+		_rebuilt_root(block, rebuilt);
+		same &= !memcmp(root, rebuilt, SHA256_DIGEST_LENGTH);
+		for (pos = 0; pos <= (uint32_t)i; pos++)
+		{
+			tx = llist_get_node_at(block->transactions, pos);
+			proof = block_merkle_proof(block, pos, &len);
+			proven &= merkle_proof_verify(root, tx->id, pos, i + 1, proof,
+				len);
+			if (len)
+				proof[0] ^= 1;
+			tampered |= len && merkle_proof_verify(root, tx->id, pos, i + 1,
+				proof, len);
+			free(proof);
+		}
+	}
+	printf("Incremental root: %d, proofs: %d, tampered proofs: %d\n",
+		same, proven, tampered);
+
+	/* Removing the last transactions rehashes their parents */
+	list = llist_create(MT_SUPPORT_FALSE);
+	for (i = 0; i < llist_size(block->transactions); i++)
+	{
+		tx = llist_get_node_at(block->transactions, i);
+		if (i < 35)
+			llist_add_node(list, tx, ADD_NODE_REAR);
+		else
+			transaction_destroy(tx);
+	}
+	llist_destroy(block->transactions, 0, NULL);
+	block->transactions = list;
+	block_merkle_sync(block);
+	block_merkle_root(block, root);
+	_rebuilt_root(block, rebuilt);
+	printf("Root after removal: %d\n",
+		!memcmp(root, rebuilt, SHA256_DIGEST_LENGTH));
+	block_destroy(block);
+}
+
+/**
+ * _check_parallel - Mines a large Merkle Block on several threads
+ *
+ * @miner: Key of the miner
+ */
+static void _check_parallel(EC_KEY *miner)
+{
+	block_t *block = block_create(&_genesis, NULL, 0);
+	uint8_t root[SHA256_DIGEST_LENGTH], rebuilt[SHA256_DIGEST_LENGTH];
+	int i;
+
+	block_set_version(block, BLOCK_VERSION_MERKLE);
+	block->info.difficulty = 8;
+	for (i = 0; i < 300; i++)
+		llist_add_node(block->transactions, coinbase_create(miner, i),
+			ADD_NODE_REAR);
+	block_mine_parallel(block, 8);
+	block_merkle_root(block, root);
+	_rebuilt_root(block, rebuilt);
+	printf("Mined on 8 threads: %d, root: %d\n", block_hashes_match(block) &&
+		hash_matches_difficulty(block->hash, block->info.difficulty),
+		!memcmp(root, rebuilt, SHA256_DIGEST_LENGTH));
+	block_destroy(block);
+}
+
+/**
+ * _check_file - Saves and loads a Blockchain, checking its format
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @path: Path of the file
+ */
+static void _check_file(blockchain_t const *blockchain, char const *path)
+{
+	blockchain_t *mapped, *parallel, *read;
+	char version[LEN_VERSION + 1] = {0};
+	block_t *tail = llist_get_tail(blockchain->chain), *block;
+	FILE *file;
+
+	blockchain_serialize(blockchain, path);
+	file = fopen(path, "rb");
+	fseek(file, LEN_MAGIC, SEEK_SET);
+	fread(version, LEN_VERSION, 1, file);
+	fclose(file);
+
+	mapped = blockchain_deserialize_mapped(path);
+	parallel = blockchain_deserialize_parallel(path, 4);
+	read = blockchain_deserialize(path);
+	block = blockchain_read_block(path, tail->info.index);
+	printf("Version %s, tail version %u, loaded: %d %d %d %d\n", version,
+		tail->version,
+		mapped && !memcmp(((block_t *)llist_get_tail(mapped->chain))->hash,
+			tail->hash, SHA256_DIGEST_LENGTH),
+		parallel != NULL,
+		read && block_hashes_match(llist_get_tail(read->chain)),
+		block && block->version == tail->version && block_hashes_match(block));
+
+	block_destroy(block);
+	blockchain_destroy(read);
+	blockchain_destroy(parallel);
+	blockchain_destroy(mapped);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain, *loaded;
+	EC_KEY *miner = ec_create();
+	block_t *block;
+	size_t written;
+	int i;
+
+	_check_tree(miner);
+	_check_parallel(miner);
+
+	blockchain = blockchain_create();
+	for (i = 0; i < 6; i++)
+		_mine_version(blockchain, miner, BLOCK_VERSION_LIST, i > 0);
+	_check_file(blockchain, "merkle.hblk");
+	blockchain_save_incremental(blockchain, "merkle.hblk", NULL);
+
+	/* The log of a legacy file is compacted for Merkle Blocks */
+	for (i = 0; i < 6; i++)
+		_mine_version(blockchain, miner, BLOCK_VERSION_MERKLE, 1);
+	blockchain_save_incremental(blockchain, "merkle.hblk", NULL);
+	_check_file(blockchain, "merkle.hblk");
+	_mine_version(blockchain, miner, BLOCK_VERSION_MERKLE, 1);
+	blockchain_save_incremental(blockchain, "merkle.hblk", &written);
+	block = llist_get_tail(blockchain->chain);
+	printf("Logged %lu bytes for %lu\n", (unsigned long)written,
+		(unsigned long)(sizeof(int32_t) + block_serialized_size(block, 1)));
+	loaded = blockchain_load("merkle.hblk", 4);
+	printf("Reloaded %d Blocks, tail: %d\n",
+		loaded ? llist_size(loaded->chain) : -1,
+		loaded && !memcmp(((block_t *)llist_get_tail(loaded->chain))->hash,
+			block->hash, SHA256_DIGEST_LENGTH));
+
+	/* A Block may not go back to an older version */
+	_mine_version(blockchain, miner, BLOCK_VERSION_LIST, 1);
+	printf("%d Blocks\n", llist_size(blockchain->chain));
+
+	blockchain_destroy(loaded);
+	blockchain_destroy(blockchain);
+	remove("merkle.hblk"), remove("merkle.hblk.idx");
+	remove("merkle.hblk.utxo"), remove("merkle.hblk.log");
+	EC_KEY_free(miner);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,70 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "blockchain.h"
+
+void _blockchain_print_brief(blockchain_t const *blockchain);
+void _print_hex_buffer(uint8_t const *buf, size_t len);
+
+static block_t *_add_block(blockchain_t *blockchain, block_t const *prev,
+	char const *s, EC_KEY *miner, unsigned int nthreads)
+{
+	block_t *block;
+	transaction_t *coinbase;
+
+	block = block_create(prev, (int8_t *)s, (uint32_t)strlen(s));
+	block->info.difficulty = 20;
+
+	coinbase = coinbase_create(miner, block->info.index);
+	llist_add_node(block->transactions, coinbase, ADD_NODE_FRONT);
+
+	block_mine_parallel(block, nthreads);
+
+	if (block_is_valid(block, prev, blockchain->unspent) == 0)
+	{
+		printf("Block mined with %u threads: [%u] ", nthreads,
+			block->info.difficulty);
+		_print_hex_buffer(block->hash, SHA256_DIGEST_LENGTH);
+		printf("\n");
+		blockchain->unspent = update_unspent(block->transactions,
+			block->hash, blockchain->unspent);
+		llist_add_node(blockchain->chain, block, ADD_NODE_REAR);
+	}
+	else
+	{
+		fprintf(stderr, "Invalid Block with index: %u\n",
+			block->info.index);
+	}
+
+	return (block);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	block_t *block;
+	EC_KEY *miner;
+
+	miner = ec_create();
+	blockchain = blockchain_create();
+	block = llist_get_head(blockchain->chain);
+	block = _add_block(blockchain, block, "Holberton", miner, 1);
+	block = _add_block(blockchain, block, "School", miner, 2);
+	block = _add_block(blockchain, block, "of", miner, 4);
+	block = _add_block(blockchain, block, "Software", miner, 8);
+	block = _add_block(blockchain, block, "Engineering", miner, 0);
+
+	_blockchain_print_brief(blockchain);
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(miner);
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,99 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+
+#include "blockchain.h"
+
+void _mine(blockchain_t *blockchain, EC_KEY *miner, EC_KEY *receiver);
+
+/**
+ * _load - Loads a Blockchain, and compares its unspent outputs to the ones
+ * in memory
+ */
+static void _load(blockchain_t *blockchain, char const *path)
+{
+	blockchain_t *loaded = blockchain_load(path, 2);
+	uint8_t a[SHA256_DIGEST_LENGTH], b[SHA256_DIGEST_LENGTH];
+
+	utxo_commitment(blockchain->unspent, a);
+	utxo_commitment(loaded->unspent, b);
+	printf("Load: %d unspent, %lu indexed, same commitment: %d\n",
+		llist_size(loaded->unspent),
+		(unsigned long)loaded->unspent_index->outputs.size,
+		!memcmp(a, b, SHA256_DIGEST_LENGTH));
+	blockchain_destroy(loaded);
+}
+
+/**
+ * _verify - Runs a background check, and prints its result
+ */
+static void _verify(blockchain_t *blockchain, EC_KEY *miner)
+{
+	utxo_verifier_t *verifier = utxo_verifier_start(blockchain);
+
+	/* Blocks can still be appended while the check runs */
+	_mine(blockchain, miner, NULL);
+	while (utxo_verifier_status(verifier) == UTXO_CHECK_RUNNING)
+		sched_yield();
+	printf("Check: %s\n",
+		utxo_verifier_status(verifier) == UTXO_CHECK_PASSED ?
+		"passed" : "failed");
+	utxo_verifier_destroy(verifier);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallet, *alice;
+	uint8_t a[SHA256_DIGEST_LENGTH], b[SHA256_DIGEST_LENGTH];
+	utxo_t *utxo;
+	FILE *file;
+	int i;
+
+	wallet = ec_create(), alice = ec_create();
+	blockchain = blockchain_create();
+	for (i = 0; i < 20; i++)
+		_mine(blockchain, wallet, i % 2 ? alice : NULL);
+
+	printf("Commitment:\n");
+	utxo_commitment(blockchain->unspent, a);
+	utxo = llist_pop(blockchain->unspent);
+	llist_add_node(blockchain->unspent, utxo, ADD_NODE_REAR);
+	utxo_commitment(blockchain->unspent, b);
+	printf("Same after reordering: %d\n", !memcmp(a, b, SHA256_DIGEST_LENGTH));
+
+	printf("Saved file:\n");
+	blockchain_serialize(blockchain, "check.hblk");
+	_load(blockchain, "check.hblk");
+
+	printf("Damaged unspent output:\n");
+	/* The amount of the last unspent output of the file */
+	file = fopen("check.hblk", "r+b");
+	fseek(file, -(long)(EC_PUB_LEN + SHA256_DIGEST_LENGTH + 4), SEEK_END);
+	fputc(0x7f, file);
+	fclose(file);
+	_load(blockchain, "check.hblk");
+
+	printf("Damaged unspent output, no commitment:\n");
+	remove("check.hblk.utxo");
+	_load(blockchain, "check.hblk");
+
+	printf("Background check:\n");
+	_verify(blockchain, wallet);
+	utxo = llist_get_head(blockchain->unspent);
+	utxo->out.amount++;
+	_verify(blockchain, wallet);
+	utxo->out.amount--;
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice);
+	remove("check.hblk"), remove("check.hblk.idx");
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,62 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_mine_tx(blockchain_t *blockchain, EC_KEY *miner, transaction_t *tx);
+int _same_files(char const *a, char const *b);
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain, *mapped;
+	EC_KEY *wallet, *alice;
+	transaction_t *tx;
+	uint8_t pub[EC_PUB_LEN];
+	int i;
+
+	wallet = ec_create(), alice = ec_create();
+	blockchain = blockchain_create();
+	for (i = 0; i < 4; i++)
+		_mine_tx(blockchain, wallet, NULL);
+	tx = transaction_create_indexed(wallet, alice, 120,
+		blockchain->unspent_index);
+	_mine_tx(blockchain, alice, tx);
+	blockchain_serialize(blockchain, "save.hblk");
+
+	mapped = blockchain_deserialize_mapped("save.hblk");
+	printf("Loaded: %d Blocks, %d unspent\n", llist_size(mapped->chain),
+		llist_size(mapped->unspent));
+	blockchain_serialize(mapped, "mapped.hblk");
+	printf("Same bytes: %d\n", _same_files("save.hblk", "mapped.hblk"));
+
+	/* Extend the loaded Blockchain, and save it over its own file */
+	tx = transaction_create_indexed(alice, wallet, 30,
+		mapped->unspent_index);
+	printf("block_apply: %d\n", _mine_tx(mapped, wallet, tx) ? 0 : -1);
+	printf("Saved over the mapped file: %d\n",
+		blockchain_serialize(mapped, "save.hblk"));
+	blockchain_destroy(mapped);
+
+	mapped = blockchain_deserialize_mapped("save.hblk");
+	printf("Reloaded: %d Blocks, %d unspent\n", llist_size(mapped->chain),
+		llist_size(mapped->unspent));
+	ec_to_pub(wallet, pub);
+	printf("Balance of the wallet: %lu\n",
+		utxo_index_address(mapped->unspent_index, pub)->balance);
+	blockchain_destroy(mapped);
+
+	printf("Missing file: %p\n", (void *)blockchain_deserialize_mapped(
+		"missing.hblk"));
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice);
+	remove("save.hblk"), remove("mapped.hblk");
+
+	return (EXIT_SUCCESS);
+}
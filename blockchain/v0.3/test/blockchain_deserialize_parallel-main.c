@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_mine_tx(blockchain_t *blockchain, EC_KEY *miner, transaction_t *tx);
+int _same_files(char const *a, char const *b);
+void _print_hex_buffer(uint8_t const *buf, size_t len);
+
+/* Offset of the timestamp of the genesis Block, past the file header */
+#define GENESIS_TIMESTAMP (LEN_MAGIC + LEN_VERSION + 1 + 4 + 4 + 8)
+
+/**
+ * _load - Loads a Blockchain on nthreads threads and prints its size
+ */
+static void _load(char const *path, unsigned int nthreads)
+{
+	blockchain_t *blockchain = blockchain_deserialize_parallel(path,
+		nthreads);
+
+	if (!blockchain)
+	{
+		printf("%u threads: failed\n", nthreads);
+		return;
+	}
+	printf("%u threads: %d Blocks, %d unspent\n", nthreads,
+		llist_size(blockchain->chain), llist_size(blockchain->unspent));
+	blockchain_serialize(blockchain, "reloaded.hblk");
+	printf("Same bytes: %d\n", _same_files(path, "reloaded.hblk"));
+	blockchain_destroy(blockchain);
+}
+
+/**
+ * _read - Reads a single Block and prints its hash
+ */
+static void _read(char const *path, blockchain_t *blockchain, uint32_t i)
+{
+	block_t *block = blockchain_read_block(path, i);
+
+	printf("Block %u: ", i);
+	if (!block)
+	{
+		printf("not found\n");
+		return;
+	}
+	_print_hex_buffer(block->hash, 8);
+	printf(", %d transactions, matches: %d\n",
+		llist_size(block->transactions),
+		!memcmp(block->hash,
+		((block_t *)llist_get_node_at(blockchain->chain, i))->hash,
+		SHA256_DIGEST_LENGTH));
+	block_destroy(block);
+}
+
+/**
+ * _flip - Flips a byte of a file
+ */
+static void _flip(char const *path, long offset)
+{
+	FILE *file = fopen(path, "r+b");
+	int c;
+
+	fseek(file, offset, SEEK_SET);
+	c = fgetc(file);
+	fseek(file, offset, SEEK_SET);
+	fputc(c ^ 1, file);
+	fclose(file);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallet, *alice;
+	transaction_t *tx;
+	FILE *file;
+	int i;
+
+	wallet = ec_create(), alice = ec_create();
+	blockchain = blockchain_create();
+	for (i = 0; i < 40; i++)
+	{
+		tx = i > 0 && i % 3 == 0 ? transaction_create_indexed(wallet, alice,
+			10 + i, blockchain->unspent_index) : NULL;
+		_mine_tx(blockchain, wallet, tx);
+	}
+	blockchain_serialize(blockchain, "save.hblk");
+
+	_load("save.hblk", 1);
+	_load("save.hblk", 4);
+	_read("save.hblk", blockchain, 0);
+	_read("save.hblk", blockchain, 21);
+	_read("save.hblk", blockchain, 40);
+	_read("save.hblk", blockchain, 41);
+
+	printf("Tampered Block:\n");
+	_flip("save.hblk", 2000);
+	_load("save.hblk", 4);
+	_flip("save.hblk", 2000);
+
+	/* Unlike a signature, the timestamp is covered by the Block hash */
+	printf("Tampered hash:\n");
+	_flip("save.hblk", GENESIS_TIMESTAMP);
+	_load("save.hblk", 4);
+	_flip("save.hblk", GENESIS_TIMESTAMP);
+
+	printf("Stale index:\n");
+	file = fopen("save.hblk", "ab");
+	fputc(0, file);
+	fclose(file);
+	_read("save.hblk", blockchain, 21);
+	blockchain_serialize(blockchain, "save.hblk");
+
+	/* Offsets of another file of the same size */
+	printf("Stale index of the same size:\n");
+	_flip("save.hblk.idx", HIDX_HEADER_LEN + 5 * sizeof(uint64_t));
+	_load("save.hblk", 4);
+
+	printf("No index:\n");
+	remove("save.hblk.idx");
+	_load("save.hblk", 4);
+	_read("save.hblk", blockchain, 21);
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice);
+	remove("save.hblk"), remove("reloaded.hblk"), remove("reloaded.hblk.idx");
+	remove("save.hblk.utxo"), remove("reloaded.hblk.utxo");
+
+	return (EXIT_SUCCESS);
+}
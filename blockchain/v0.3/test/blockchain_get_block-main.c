@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+/**
+ * _append - Appends a mined Block to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @miner: Key of the miner
+ * @apply: 1 to append the Block with block_apply(), 0 to append it to the
+ *         chain directly
+ */
+static void _append(blockchain_t *blockchain, EC_KEY *miner, int apply)
+{
+	block_t *prev = llist_get_tail(blockchain->chain), *block;
+
+	block = block_create(prev, (int8_t *)"Block", 5);
+	block->info.difficulty = 4;
+	llist_add_node(block->transactions,
+		coinbase_create(miner, block->info.index), ADD_NODE_FRONT);
+	block_mine(block);
+	if (apply)
+		block_apply(blockchain, block, 1);
+	else
+		llist_add_node(blockchain->chain, block, ADD_NODE_REAR);
+}
+
+/**
+ * _check - Checks every lookup against the chain
+ *
+ * @blockchain: Pointer to the Blockchain
+ */
+static void _check(blockchain_t const *blockchain)
+{
+	int i, size = llist_size(blockchain->chain), at = 1, by_hash = 1;
+	block_t *block;
+
+	for (i = 0; i < size; i++)
+	{
+		block = llist_get_node_at(blockchain->chain, i);
+		at &= blockchain_get_block_at(blockchain, i) == block;
+		by_hash &= blockchain_get_block_by_hash(blockchain,
+			block->hash) == block;
+	}
+	printf("%d Blocks, %d indexed, by height: %d, by hash: %d, tip: %d\n",
+		size, (int)blockchain->chain_index->nb_blocks, at, by_hash,
+		blockchain_get_block_at(blockchain, size) == NULL);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain, *loaded;
+	uint8_t unknown[SHA256_DIGEST_LENGTH] = {0};
+	EC_KEY *miner = ec_create();
+	int i;
+
+	blockchain = blockchain_create();
+	_check(blockchain);
+	for (i = 0; i < 20; i++)
+		_append(blockchain, miner, 1);
+	_check(blockchain);
+
+	/* Blocks appended to the chain directly are caught up with */
+	for (i = 0; i < 3; i++)
+		_append(blockchain, miner, 0);
+	_check(blockchain);
+	printf("Unknown hash: %d\n",
+		blockchain_get_block_by_hash(blockchain, unknown) == NULL);
+
+	/* A chain changed in any other way is indexed again */
+	block_destroy(llist_pop(blockchain->chain));
+	_append(blockchain, miner, 0);
+	_check(blockchain);
+
+	blockchain_serialize(blockchain, "get_block.hblk");
+	loaded = blockchain_deserialize_parallel("get_block.hblk", 2);
+	_check(loaded);
+
+	blockchain_destroy(loaded);
+	blockchain_destroy(blockchain);
+	remove("get_block.hblk"), remove("get_block.hblk.idx");
+	remove("get_block.hblk.utxo");
+	EC_KEY_free(miner);
+	return (EXIT_SUCCESS);
+}
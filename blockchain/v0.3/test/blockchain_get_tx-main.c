@@ -0,0 +1,78 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+void _mine(blockchain_t *blockchain, EC_KEY *miner, EC_KEY *receiver);
+
+/**
+ * _check - Looks every transaction and input of a Blockchain up
+ *
+ * @blockchain: Pointer to the Blockchain
+ */
+static void _check(blockchain_t const *blockchain)
+{
+	int b, t, i, nb_tx = 0, found = 1, anchored = 1;
+	block_t *block;
+	transaction_t *tx;
+	uint32_t height, pos;
+
+	for (b = 0; b < llist_size(blockchain->chain); b++)
+	{
+		block = llist_get_node_at(blockchain->chain, b);
+		for (t = 0; t < llist_size(block->transactions); t++, nb_tx++)
+		{
+			tx = llist_get_node_at(block->transactions, t);
+			found &= blockchain_get_tx(blockchain, tx->id, &height, &pos) ==
+				tx && height == (uint32_t)b && pos == (uint32_t)t;
+			/* Coinbase inputs refer to no Block */
+			for (i = 0; t && i < llist_size(tx->inputs); i++)
+				anchored &= blockchain_input_is_anchored(blockchain,
+					llist_get_node_at(tx->inputs, i));
+		}
+	}
+	printf("%d transactions, found: %d, inputs anchored: %d\n",
+		nb_tx, found, anchored);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain, *loaded;
+	EC_KEY *miner = ec_create(), *receiver = ec_create();
+	block_t *block;
+	tx_in_t in;
+	int i;
+
+	blockchain = blockchain_create();
+	for (i = 0; i < 40; i++)
+		_mine(blockchain, miner, i > 0 ? receiver : NULL);
+	_check(blockchain);
+
+	/* An input naming another Block is not anchored */
+	block = llist_get_tail(blockchain->chain);
+	memcpy(&in, llist_get_node_at(((transaction_t *)
+		llist_get_node_at(block->transactions, 1))->inputs, 0), sizeof(in));
+	printf("Anchored: %d\n", blockchain_input_is_anchored(blockchain, &in));
+	memcpy(in.block_hash, block->hash, SHA256_DIGEST_LENGTH);
+	printf("Anchored in the wrong Block: %d\n",
+		blockchain_input_is_anchored(blockchain, &in));
+	printf("Unknown transaction: %d\n",
+		blockchain_get_tx(blockchain, block->hash, NULL, NULL) == NULL);
+
+	blockchain_serialize(blockchain, "get_tx.hblk");
+	loaded = blockchain_deserialize_parallel("get_tx.hblk", 4);
+	_check(loaded);
+
+	blockchain_destroy(loaded);
+	blockchain_destroy(blockchain);
+	remove("get_tx.hblk"), remove("get_tx.hblk.idx");
+	remove("get_tx.hblk.utxo");
+	EC_KEY_free(miner), EC_KEY_free(receiver);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,134 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+int _same_files(char const *a, char const *b);
+
+/* Blockchain file written by the 0.3 serializer, from the Blocks below */
+#define GOLDEN_PATH "test/golden-0.3.hblk"
+
+/**
+ * _pub - Derives a fixed public key from a name
+ *
+ * @name: Name of the owner of the key
+ * @pub: Buffer receiving the key, EC_PUB_LEN bytes long
+ *
+ * Return: pub
+ */
+static uint8_t *_pub(char const *name, uint8_t *pub)
+{
+	pub[0] = 0x04;
+	sha256((int8_t *)name, strlen(name), pub + 1);
+	sha256((int8_t *)pub + 1, SHA256_DIGEST_LENGTH,
+		pub + 1 + SHA256_DIGEST_LENGTH);
+	return (pub);
+}
+
+/**
+ * _transaction - Creates a transaction with one input and one output,
+ * and a fixed signature
+ *
+ * @spent: Unspent output spent by the input, or NULL for a coinbase
+ * @index: Index of the Block, for a coinbase
+ * @amount: Amount of the output
+ * @owner: Name of the owner of the output
+ *
+ * Return: Pointer to the transaction
+ */
+static transaction_t *_transaction(unspent_tx_out_t const *spent,
+	uint32_t index, uint32_t amount, char const *owner)
+{
+	transaction_t *tx = calloc(1, sizeof(*tx));
+	uint8_t pub[EC_PUB_LEN];
+	tx_in_t *in;
+
+	tx->inputs = llist_create(MT_SUPPORT_FALSE);
+	tx->outputs = llist_create(MT_SUPPORT_FALSE);
+	if (spent)
+		in = tx_in_create(spent);
+	else
+	{
+		in = calloc(1, sizeof(*in));
+		memcpy(in->tx_out_hash, &index, sizeof(index));
+	}
+	llist_add_node(tx->inputs, in, ADD_NODE_REAR);
+	llist_add_node(tx->outputs, tx_out_create(amount, _pub(owner, pub)),
+		ADD_NODE_REAR);
+	transaction_hash(tx, tx->id);
+	if (spent)
+	{
+		memcpy(in->sig.sig, &amount, sizeof(amount));
+		in->sig.len = sizeof(amount);
+	}
+	return (tx);
+}
+
+/**
+ * _add_block - Appends a Block with a fixed timestamp to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @data: Data of the Block
+ * @miner: Name of the owner of the coinbase output
+ * @spent: Unspent output the Block spends, or NULL
+ * @receiver: Name of the owner of the output created from spent
+ *
+ * Return: Pointer to the Block
+ */
+static block_t *_add_block(blockchain_t *blockchain, char const *data,
+	char const *miner, unspent_tx_out_t const *spent, char const *receiver)
+{
+	block_t *prev = llist_get_tail(blockchain->chain), *block;
+
+	block = block_create(prev, (int8_t *)data, (uint32_t)strlen(data));
+	block->info.timestamp = 1234567890 + block->info.index;
+	llist_add_node(block->transactions, _transaction(NULL, block->info.index,
+		COINBASE_AMOUNT, miner), ADD_NODE_REAR);
+	if (spent)
+		llist_add_node(block->transactions, _transaction(spent, 0,
+			spent->out.amount, receiver), ADD_NODE_REAR);
+	block_hash(block, block->hash);
+	blockchain->unspent = update_unspent(block->transactions, block->hash,
+		blockchain->unspent);
+	llist_add_node(blockchain->chain, block, ADD_NODE_REAR);
+	return (block);
+}
+
+/**
+ * main - Entry point
+ *
+ * Description: The file written for a fixed Blockchain must stay the one
+ * of the 0.3 format, and reading that file back must give the same bytes.
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+
+	blockchain = blockchain_create();
+	_add_block(blockchain, "Holberton School", "Alice", NULL, NULL);
+	_add_block(blockchain, "Software Engineering", "Bob", NULL, NULL);
+	_add_block(blockchain, "Blockchain", "Alice",
+		llist_get_head(blockchain->unspent), "Carol");
+	_add_block(blockchain, "Golden", "Carol",
+		llist_get_head(blockchain->unspent), "Alice");
+
+	blockchain_serialize(blockchain, "golden.hblk");
+	printf("Same bytes as the 0.3 file: %d\n",
+		_same_files("golden.hblk", GOLDEN_PATH));
+	blockchain_destroy(blockchain);
+
+	blockchain = blockchain_deserialize(GOLDEN_PATH);
+	printf("Loaded: %d Blocks, %d unspent\n",
+		blockchain ? llist_size(blockchain->chain) : -1,
+		blockchain ? llist_size(blockchain->unspent) : -1);
+	blockchain_serialize(blockchain, "golden.hblk");
+	printf("Same bytes once reloaded: %d\n",
+		_same_files("golden.hblk", GOLDEN_PATH));
+	blockchain_destroy(blockchain);
+
+	remove("golden.hblk");
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,106 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+void _mine(blockchain_t *blockchain, EC_KEY *miner, EC_KEY *receiver);
+
+/**
+ * _save - Saves a Blockchain and prints the number of Blocks in its log
+ */
+static void _save(blockchain_t *blockchain, char const *path)
+{
+	int ret = blockchain_save_incremental(blockchain, path, NULL);
+	chain_log_t log;
+	block_t *block;
+	struct stat st;
+
+	stat(path, &st);
+	chain_log_open(&log, path, st.st_size);
+	while ((block = chain_log_next(&log)))
+		block_destroy(block);
+	printf("Save: %d, %u Blocks in the log\n", ret, log.nb_records);
+	chain_log_close(&log);
+}
+
+/**
+ * _load - Loads a Blockchain and compares it to the one in memory
+ */
+static void _load(blockchain_t *blockchain, char const *path)
+{
+	blockchain_t *loaded = blockchain_load(path, 2);
+	block_t *a = llist_get_tail(blockchain->chain);
+	block_t *b = llist_get_tail(loaded->chain);
+
+	printf("Load: %d Blocks, %d unspent, same tail: %d, same unspent: %d\n",
+		llist_size(loaded->chain), llist_size(loaded->unspent),
+		!memcmp(a->hash, b->hash, SHA256_DIGEST_LENGTH),
+		llist_size(loaded->unspent) == llist_size(blockchain->unspent) &&
+		loaded->unspent_index->outputs.size == blockchain->unspent_index->outputs.size);
+	blockchain_destroy(loaded);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain;
+	EC_KEY *wallet, *alice;
+	FILE *file;
+	int i;
+
+	wallet = ec_create(), alice = ec_create();
+	blockchain = blockchain_create();
+	for (i = 0; i < 30; i++)
+		_mine(blockchain, wallet, i % 2 ? alice : NULL);
+
+	remove("chain.hblk.log");
+	printf("First save:\n");
+	_save(blockchain, "chain.hblk");
+	_save(blockchain, "chain.hblk");
+
+	printf("New Blocks:\n");
+	_mine(blockchain, wallet, alice);
+	_save(blockchain, "chain.hblk");
+	_mine(blockchain, wallet, NULL);
+	_mine(blockchain, wallet, alice);
+	_save(blockchain, "chain.hblk");
+	_load(blockchain, "chain.hblk");
+
+	printf("Damaged record:\n");
+	_mine(blockchain, wallet, alice);
+	file = fopen("chain.hblk.log", "ab");
+	fwrite("\x10\x00\x00\x00garbage", 1, 11, file);
+	fclose(file);
+	blockchain_destroy(blockchain_load("chain.hblk", 1));
+	_save(blockchain, "chain.hblk");
+	_load(blockchain, "chain.hblk");
+
+	printf("Compaction:\n");
+	for (i = 0; i < CHAIN_LOG_COMPACT_INTERVAL; i++)
+	{
+		_mine(blockchain, wallet, NULL);
+		blockchain_save_incremental(blockchain, "chain.hblk", NULL);
+	}
+	_mine(blockchain, wallet, alice);
+	_save(blockchain, "chain.hblk");
+	_load(blockchain, "chain.hblk");
+
+	printf("Another Blockchain:\n");
+	blockchain_destroy(blockchain);
+	blockchain = blockchain_create();
+	_mine(blockchain, alice, NULL);
+	_save(blockchain, "chain.hblk");
+	_load(blockchain, "chain.hblk");
+
+	blockchain_destroy(blockchain);
+	EC_KEY_free(wallet), EC_KEY_free(alice);
+	remove("chain.hblk"), remove("chain.hblk.idx"), remove("chain.hblk.log");
+	remove("chain.hblk.utxo");
+
+	return (EXIT_SUCCESS);
+}
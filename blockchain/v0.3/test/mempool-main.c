@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "blockchain.h"
+
+block_t *_new_block(blockchain_t *blockchain, EC_KEY *miner);
+block_t *_mine_block(blockchain_t *blockchain, block_t *block);
+
+#define NB_KEYS 12
+
+/**
+ * _mine_pool - Appends a mined Block of pending transactions to a Blockchain
+ *
+ * @blockchain: Pointer to the Blockchain
+ * @miner: Key of the miner
+ * @pool: Mempool the transactions of the Block are taken from, or NULL
+ * @max: Maximum number of transactions taken from pool
+ * @tx: Transaction added after those of pool, or NULL
+ *
+ * Return: Pointer to the Block, or NULL if it was rejected
+ */
+static block_t *_mine_pool(blockchain_t *blockchain, EC_KEY *miner,
+	mempool_t *pool, size_t max, transaction_t *tx)
+{
+	block_t *block = _new_block(blockchain, miner);
+
+	if (pool)
+		mempool_template(pool, block, max);
+	if (tx)
+		llist_add_node(block->transactions, tx, ADD_NODE_REAR);
+	return (_mine_block(blockchain, block));
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	blockchain_t *blockchain = blockchain_create(), *other;
+	mempool_t *pool = mempool_create();
+	EC_KEY *keys[NB_KEYS], *receiver = ec_create();
+	transaction_t *txs[NB_KEYS], *tx;
+	block_t *block;
+	int i, added = 0, removed, ordered = 1;
+	tx_in_t *in;
+
+	for (i = 0; i < NB_KEYS; i++)
+	{
+		keys[i] = ec_create();
+		_mine_pool(blockchain, keys[i], NULL, 0, NULL);
+	}
+	_mine_pool(blockchain, receiver, NULL, 0, NULL);
+	for (i = 0; i < NB_KEYS; i++)
+	{
+		txs[i] = transaction_create_indexed(keys[i], receiver, 10 + i,
+			blockchain->unspent_index);
+		added += mempool_add(pool, txs[i], blockchain->unspent_index);
+	}
+	printf("Added: %d, pending: %lu\n", added, (unsigned long)pool->size);
+	printf("Added again: %d\n",
+		mempool_add(pool, txs[0], blockchain->unspent_index));
+	printf("Found: %d\n", mempool_find(pool, txs[3]->id) != NULL &&
+		mempool_find(pool, txs[3]->id)->tx == txs[3]);
+
+	/* A second transaction spending the same output is a double spend */
+	tx = transaction_create_indexed(keys[0], receiver, 20,
+		blockchain->unspent_index);
+	printf("Double spend: %d, spender: %d\n",
+		mempool_add(pool, tx, blockchain->unspent_index),
+		mempool_spender(pool, llist_get_head(tx->inputs))->tx == txs[0]);
+	transaction_destroy(tx);
+	tx = mempool_transaction_create(pool, keys[0], receiver, 20,
+		blockchain->unspent_index);
+	printf("Created from the outputs left: %d\n", tx != NULL);
+	tx = mempool_transaction_create(pool, receiver, keys[0], 20,
+		blockchain->unspent_index);
+	printf("Created from an output not pending: %d, added: %d\n",
+		tx != NULL, mempool_add(pool, tx, blockchain->unspent_index));
+	mempool_remove(pool, mempool_find(pool, tx->id));
+	transaction_destroy(tx);
+
+	/* A bad signature is only caught after the conflicts are checked */
+	tx = transaction_create_indexed(receiver, keys[0], 1,
+		blockchain->unspent_index);
+	in = llist_get_head(tx->inputs);
+	in->sig.sig[0] ^= 1;
+	printf("Bad signature: %d, pending: %lu, outputs spent: %lu\n",
+		mempool_add(pool, tx, blockchain->unspent_index),
+		(unsigned long)pool->size, (unsigned long)pool->outpoints.size);
+	transaction_destroy(tx);
+
+	/* The oldest transactions are mined first */
+	block = _mine_pool(blockchain, keys[0], pool, 5, NULL);
+	for (i = 0; block && i < 5; i++)
+		ordered &= llist_get_node_at(block->transactions, i + 1) == txs[i];
+	printf("Mined: %d, in order: %d, pending: %lu\n", block != NULL,
+		ordered, (unsigned long)pool->size);
+	printf("Removed after the Block: %d\n", mempool_remove_block(pool, block));
+
+	/* A Block spending the output of a pending transaction evicts it */
+	tx = transaction_create_indexed(keys[6], keys[0], 3,
+		blockchain->unspent_index);
+	in = llist_get_head(tx->inputs);
+	printf("Conflicting: %d\n", mempool_spender(pool, in) != NULL);
+	block = _mine_pool(blockchain, keys[0], NULL, 0, tx);
+	removed = mempool_remove_block(pool, block);
+	printf("Mined: %d, removed after the Block: %d, pending: %lu\n",
+		block != NULL, removed, (unsigned long)pool->size);
+	printf("Outputs still spent: %lu\n", (unsigned long)pool->outpoints.size);
+
+	/* Against another Blockchain, no pending transaction is valid */
+	other = blockchain_create();
+	removed = mempool_revalidate(pool, other->unspent_index);
+	printf("Removed for another Blockchain: %d, pending: %lu\n", removed,
+		(unsigned long)pool->size);
+
+	blockchain_destroy(other);
+	mempool_destroy(pool);
+	blockchain_destroy(blockchain);
+	for (i = 0; i < NB_KEYS; i++)
+		EC_KEY_free(keys[i]);
+	EC_KEY_free(receiver);
+	return (EXIT_SUCCESS);
+}
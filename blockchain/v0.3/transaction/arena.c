@@ -0,0 +1,116 @@
+#include "transaction.h"
+
+/* Defined after */
+arena_chunk_t *arena_chunk_create(arena_chunk_t *prev, size_t size);
+
+/**
+ * arena_create - Creates an arena
+ * @size: Number of bytes expected to be allocated from the arena, the arena
+ *		  grows beyond it if needed
+ *
+ * Return: Pointer to the arena, or NULL on failure
+*/
+arena_t *arena_create(size_t size)
+{
+	arena_chunk_t *chunk;
+	arena_t *arena;
+
+	chunk = arena_chunk_create(NULL, ARENA_ROUND(sizeof(*arena)) + size);
+	if (!chunk)
+		return (NULL);
+
+	arena = (arena_t *)((uint8_t *)chunk + ARENA_ROUND(sizeof(*chunk)));
+	chunk->used = ARENA_ROUND(sizeof(*arena));
+	arena->chunk = chunk;
+	return (arena);
+}
+
+/**
+ * arena_chunk_create - Allocates a chunk of an arena
+ * @prev: Chunk allocated before, or NULL for the first chunk
+ * @size: Number of bytes usable in the chunk
+ *
+ * Return: Pointer to the chunk, or NULL on failure
+*/
+arena_chunk_t *arena_chunk_create(arena_chunk_t *prev, size_t size)
+{
+	arena_chunk_t *chunk;
+
+	size = ARENA_ROUND(size);
+	chunk = malloc(ARENA_ROUND(sizeof(*chunk)) + size);
+	if (!chunk)
+		return (NULL);
+
+	chunk->prev = prev;
+	chunk->size = size;
+	chunk->used = 0;
+	return (chunk);
+}
+
+/**
+ * arena_alloc - Allocates zeroed memory from an arena
+ * @arena: Pointer to the arena, or NULL to allocate from the heap
+ * @size: Number of bytes to allocate
+ *
+ * Description: Memory allocated from an arena can't be freed on its own,
+ * it is freed with the arena by arena_destroy().
+ *
+ * Return: Pointer to the memory, or NULL on failure
+*/
+void *arena_alloc(arena_t *arena, size_t size)
+{
+	arena_chunk_t *chunk;
+	uint8_t *ptr;
+
+	if (!arena)
+		return (calloc(1, size));
+
+	size = ARENA_ROUND(size);
+	chunk = arena->chunk;
+	if (chunk->size - chunk->used < size)
+	{
+		chunk = arena_chunk_create(chunk, size > 2 * chunk->size ?
+										  size : 2 * chunk->size);
+		if (!chunk)
+			return (NULL);
+		arena->chunk = chunk;
+	}
+
+	ptr = (uint8_t *)chunk + ARENA_ROUND(sizeof(*chunk)) + chunk->used;
+	chunk->used += size;
+	memset(ptr, 0, size);
+	return (ptr);
+}
+
+/**
+ * arena_free - Frees memory allocated by arena_alloc()
+ * @arena: Arena the memory was allocated from, or NULL if it was allocated
+ *		   from the heap
+ * @ptr: Pointer to the memory
+ *
+ * Description: Memory allocated from an arena is left to the arena.
+*/
+void arena_free(arena_t *arena, void *ptr)
+{
+	if (!arena)
+		free(ptr);
+}
+
+/**
+ * arena_destroy - Frees an arena, and all the memory allocated from it
+ * @arena: Pointer to the arena, may be NULL
+*/
+void arena_destroy(arena_t *arena)
+{
+	arena_chunk_t *chunk, *prev;
+
+	if (!arena)
+		return;
+
+	/* The first chunk, holding the arena itself, is freed last */
+	for (chunk = arena->chunk; chunk; chunk = prev)
+	{
+		prev = chunk->prev;
+		free(chunk);
+	}
+}
@@ -0,0 +1,127 @@
+#include "transaction.h"
+
+/* Defined after */
+int utxo_cmp_amount_desc(void const *a, void const *b);
+
+/**
+ * coin_select_largest_first - Picks the largest unspent outputs until they
+ *							   cover an amount
+ * @utxos: Array of the unspent outputs of the sender
+ * @nb_utxos: Number of unspent outputs in utxos
+ * @amount: Amount to cover
+ * @selected: Array of nb_utxos pointers, receives the picked outputs
+ *
+ * Description: No other set of outputs covers amount with fewer inputs.
+ * At least one output is picked, even for an amount of 0.
+ *
+ * Return: Number of outputs picked, or 0 if they cannot cover amount
+*/
+size_t coin_select_largest_first(utxo_t * const *utxos, size_t nb_utxos,
+								 uint32_t amount, utxo_t **selected)
+{
+	uint64_t total = 0;
+	size_t nb = 0;
+
+	if (!utxos || !selected || !nb_utxos)
+		return (0);
+
+	memcpy(selected, utxos, nb_utxos * sizeof(*selected));
+	qsort(selected, nb_utxos, sizeof(*selected), utxo_cmp_amount_desc);
+	do {
+		total += selected[nb++]->out.amount;
+	} while (total < amount && nb < nb_utxos);
+
+	return (total < amount ? 0 : nb);
+}
+
+/**
+ * coin_select_smallest_sufficient - Picks the smallest unspent output
+ *									 covering an amount on its own
+ * @utxos: Array of the unspent outputs of the sender
+ * @nb_utxos: Number of unspent outputs in utxos
+ * @amount: Amount to cover
+ * @selected: Array of nb_utxos pointers, receives the picked outputs
+ *
+ * Description: Spends a single output, leaving the least change. If no
+ * output covers amount alone, falls back to coin_select_largest_first().
+ *
+ * Return: Number of outputs picked, or 0 if they cannot cover amount
+*/
+size_t coin_select_smallest_sufficient(utxo_t * const *utxos,
+									   size_t nb_utxos, uint32_t amount,
+									   utxo_t **selected)
+{
+	utxo_t *best = NULL;
+	size_t i;
+
+	if (!utxos || !selected)
+		return (0);
+
+	for (i = 0; i < nb_utxos; i++)
+	{
+		if (utxos[i]->out.amount >= amount &&
+			(!best || utxos[i]->out.amount < best->out.amount))
+			best = utxos[i];
+	}
+	if (!best)
+		return (coin_select_largest_first(utxos, nb_utxos, amount, selected));
+
+	selected[0] = best;
+	return (1);
+}
+
+/**
+ * coin_select_default - Picks the fewest unspent outputs covering an
+ *						 amount, avoiding change when possible
+ * @utxos: Array of the unspent outputs of the sender
+ * @nb_utxos: Number of unspent outputs in utxos
+ * @amount: Amount to cover
+ * @selected: Array of nb_utxos pointers, receives the picked outputs
+ *
+ * Description: coin_select_largest_first() gives the fewest number of
+ * inputs. Among the sets of that size, one matching amount exactly is
+ * preferred, as the transaction then needs no change output, then the
+ * smallest single output if one input is enough.
+ *
+ * Return: Number of outputs picked, or 0 if they cannot cover amount
+*/
+size_t coin_select_default(utxo_t * const *utxos, size_t nb_utxos,
+						   uint32_t amount, utxo_t **selected)
+{
+	size_t nb, nb_exact;
+
+	nb = coin_select_largest_first(utxos, nb_utxos, amount, selected);
+	if (nb == 1)
+		return (coin_select_smallest_sufficient(utxos, nb_utxos, amount,
+												selected));
+	if (nb == 0)
+		return (0);
+
+	nb_exact = coin_select_exact(utxos, nb_utxos, amount, nb, selected);
+	return (nb_exact ? nb_exact : nb);
+}
+
+/**
+ * utxo_cmp_amount_desc - qsort() comparator ordering unspent outputs by
+ *						  decreasing amount
+ * @a: Pointer to the first utxo_t pointer
+ * @b: Pointer to the second utxo_t pointer
+ *
+ * Description: Outputs of the same amount are ordered by transaction ID
+ * and output hash, so the selection does not depend on the order of the
+ * outputs.
+ *
+ * Return: Negative if a comes first, positive if b does, 0 if equal
+*/
+int utxo_cmp_amount_desc(void const *a, void const *b)
+{
+	utxo_t const *ua = *(utxo_t * const *) a, *ub = *(utxo_t * const *) b;
+	int cmp;
+
+	if (ua->out.amount != ub->out.amount)
+		return (ua->out.amount < ub->out.amount ? 1 : -1);
+
+	cmp = memcmp(ua->tx_id, ub->tx_id, SHA256_DIGEST_LENGTH);
+	return (cmp ? cmp : memcmp(ua->out.hash, ub->out.hash,
+							   SHA256_DIGEST_LENGTH));
+}
@@ -0,0 +1,126 @@
+#include "transaction.h"
+
+/* Defined in coin_select.c */
+int utxo_cmp_amount_desc(void const *a, void const *b);
+/* Defined after */
+void coin_search(coin_search_t *search, size_t i, uint64_t sum);
+
+/**
+ * coin_select_bnb - Picks unspent outputs matching an amount exactly
+ * @utxos: Array of the unspent outputs of the sender
+ * @nb_utxos: Number of unspent outputs in utxos
+ * @amount: Amount to match
+ * @selected: Array of nb_utxos pointers, receives the picked outputs
+ *
+ * Description: Branch-and-bound search over the outputs sorted by
+ * decreasing amount, keeping the match with the fewest inputs. The
+ * transaction then needs no change output.
+ *
+ * Return: Number of outputs picked, or 0 if no exact match was found
+*/
+size_t coin_select_bnb(utxo_t * const *utxos, size_t nb_utxos,
+					   uint32_t amount, utxo_t **selected)
+{
+	return (coin_select_exact(utxos, nb_utxos, amount, nb_utxos, selected));
+}
+
+/**
+ * coin_select_exact - Picks at most a number of unspent outputs matching
+ *					   an amount exactly
+ * @utxos: Array of the unspent outputs of the sender
+ * @nb_utxos: Number of unspent outputs in utxos
+ * @amount: Amount to match
+ * @max_inputs: Maximum number of outputs to pick
+ * @selected: Array of nb_utxos pointers, receives the picked outputs, left
+ *			  untouched if no match is found
+ *
+ * Description: At most COIN_SELECT_BNB_MAX_TRIES branches are visited, so
+ * the search stays bounded for addresses owning many outputs.
+ *
+ * Return: Number of outputs picked, or 0 if no exact match was found
+*/
+size_t coin_select_exact(utxo_t * const *utxos, size_t nb_utxos,
+						 uint32_t amount, size_t max_inputs,
+						 utxo_t **selected)
+{
+	coin_search_t search;
+	size_t i, nb = 0;
+
+	if (!utxos || !selected || !nb_utxos || !max_inputs || !amount)
+		return (0);
+
+	memset(&search, 0, sizeof(search));
+	search.sorted = malloc(nb_utxos * sizeof(*search.sorted));
+	search.remaining = malloc((nb_utxos + 1) * sizeof(*search.remaining));
+	search.current = malloc(max_inputs * sizeof(*search.current));
+	search.best = malloc(max_inputs * sizeof(*search.best));
+	if (search.sorted && search.remaining && search.current && search.best)
+	{
+		memcpy(search.sorted, utxos, nb_utxos * sizeof(*search.sorted));
+		qsort(search.sorted, nb_utxos, sizeof(*search.sorted),
+			  utxo_cmp_amount_desc);
+		search.remaining[nb_utxos] = 0;
+		for (i = nb_utxos; i > 0; i--)
+			search.remaining[i - 1] = search.remaining[i] +
+									  search.sorted[i - 1]->out.amount;
+		search.nb = nb_utxos, search.target = amount;
+		search.best_size = max_inputs + 1;
+		search.tries = COIN_SELECT_BNB_MAX_TRIES;
+		coin_search(&search, 0, 0);
+		if (search.best_size <= max_inputs)
+			nb = search.best_size;
+		for (i = 0; i < nb; i++)
+			selected[i] = search.sorted[search.best[i]];
+	}
+
+	free(search.sorted);
+	free(search.remaining);
+	free(search.current);
+	free(search.best);
+	return (nb);
+}
+
+/**
+ * coin_search - Explores the branches of a coin selection from a candidate
+ * @search: State of the search
+ * @i: Index in search->sorted of the next candidate to include or leave out
+ * @sum: Total amount of the candidates of the current branch
+ *
+ * Description: A branch is cut when it overshoots the target, when the
+ * remaining candidates cannot reach it, or when it cannot beat the best
+ * match found so far.
+*/
+void coin_search(coin_search_t *search, size_t i, uint64_t sum)
+{
+	uint64_t amount;
+	size_t next;
+
+	if (!search->tries)
+		return;
+	search->tries--;
+
+	if (sum == search->target)
+	{
+		memcpy(search->best, search->current,
+			   search->depth * sizeof(*search->best));
+		search->best_size = search->depth;
+		return;
+	}
+	if (i == search->nb || search->depth + 1 >= search->best_size ||
+		sum + search->remaining[i] < search->target)
+		return;
+
+	amount = search->sorted[i]->out.amount;
+	if (sum + amount <= search->target)
+	{
+		search->current[search->depth++] = i;
+		coin_search(search, i + 1, sum + amount);
+		search->depth--;
+	}
+
+	/* Leaving out a candidate, the next ones of the same amount are too */
+	next = i + 1;
+	while (next < search->nb && search->sorted[next]->out.amount == amount)
+		next++;
+	coin_search(search, next, sum);
+}
@@ -23,6 +23,25 @@
  *
 */
 transaction_t *coinbase_create(EC_KEY const *receiver, uint32_t block_index)
+{
+	return (coinbase_create_in(NULL, receiver, block_index));
+}
+
+/**
+ * coinbase_create_in - Creates a coinbase transaction, allocated from an
+ *						arena
+ * @arena: Arena of the Block the transaction will belong to, or NULL to
+ *		   allocate the transaction from the heap
+ * @receiver: Contains the public key of the miner,
+ *			  who will receive the coinbase coins.
+ * @block_index: Index of the Block the coinbase
+ *				 transaction will belong to.
+ *
+ * Return: Pointer to the created transaction upon success,
+ *		   or NULL upon failure.
+*/
+transaction_t *coinbase_create_in(arena_t *arena, EC_KEY const *receiver,
+								  uint32_t block_index)
 {
 	transaction_t *coinbase;
 	tx_in_t *tx_in;
@@ -35,17 +54,23 @@ transaction_t *coinbase_create(EC_KEY const *receiver, uint32_t block_index)
 		return (NULL);
 
 	/* Create the tx_out, the tx_in and the transaction */
-	tx_out = tx_out_create(COINBASE_AMOUNT, receiver_pub);
-	tx_in = malloc(sizeof(*tx_in));
-	coinbase = malloc(sizeof(*coinbase));
+	tx_out = tx_out_create_in(arena, COINBASE_AMOUNT, receiver_pub);
+	tx_in = arena_alloc(arena, sizeof(*tx_in));
+	coinbase = arena_alloc(arena, sizeof(*coinbase));
 	if (!tx_out || !tx_in || !coinbase)
 	{
-		free(tx_out), free(tx_in), free(coinbase);
+		arena_free(arena, tx_out), arena_free(arena, tx_in);
+		arena_free(arena, coinbase);
 		return (NULL);
 	}
 	/* Zero the tx_in, and copy the block_index into the */
 	/* first 4 bytes of tx_out_hash */
 	memset(tx_in, 0, sizeof(*tx_in));
+	coinbase->mapped = 0;
+	coinbase->arena = arena;
+	/* A single input and output already are contiguous arrays */
+	coinbase->input_array = tx_in, coinbase->nb_inputs = 1;
+	coinbase->output_array = tx_out, coinbase->nb_outputs = 1;
 	memcpy(tx_in->tx_out_hash, &block_index, 4);
 
 	/* Add inputs and outputs */
@@ -57,9 +82,10 @@ transaction_t *coinbase_create(EC_KEY const *receiver, uint32_t block_index)
 		(llist_add_node(coinbase->outputs, tx_out, ADD_NODE_REAR) == -1) ||
 		(!transaction_hash(coinbase, coinbase->id)))
 	{
-		llist_destroy(coinbase->inputs, 1, NULL);
-		llist_destroy(coinbase->outputs, 1, NULL);
-		free(coinbase);
+		llist_destroy(coinbase->inputs, 0, NULL);
+		llist_destroy(coinbase->outputs, 0, NULL);
+		arena_free(arena, tx_in), arena_free(arena, tx_out);
+		arena_free(arena, coinbase);
 		return (NULL);
 	}
 
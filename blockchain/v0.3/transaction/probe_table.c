@@ -0,0 +1,127 @@
+#include "transaction.h"
+
+/**
+ * probe_at - Gets a slot of a table
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @i: Number of the slot, lower than table->capacity
+ *
+ * Return: Pointer to the slot
+*/
+void *probe_at(probe_table_t const *table, probe_ops_t const *ops, size_t i)
+{
+	return ((char *) table->slots + i * ops->slot_size);
+}
+
+/**
+ * probe_find - Finds the slot holding a key, or the slot where it would be
+ *				stored
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @hash: Hash of the key
+ * @match: Tells whether a used slot holds the key
+ * @key: Key to look for, passed to match
+ *
+ * Return: Slot of the key, or if it is not in the table, the first slot it
+ *		   could be stored in: a deleted or an empty slot.
+ *		   0 if the table has no slots
+*/
+size_t probe_find(probe_table_t const *table, probe_ops_t const *ops,
+				  size_t hash, probe_match_t match, void const *key)
+{
+	size_t mask = table->capacity - 1, i, free_slot = table->capacity;
+	void const *slot;
+	int state;
+
+	if (!table->capacity)
+		return (0);
+
+	for (i = hash & mask;
+		 (state = ops->state(slot = probe_at(table, ops, i))) != PROBE_EMPTY;
+		 i = (i + 1) & mask)
+	{
+		if (state == PROBE_DELETED)
+		{
+			if (free_slot == table->capacity)
+				free_slot = i;
+		}
+		else if (match(slot, key))
+			return (i);
+	}
+
+	return (free_slot == table->capacity ? i : free_slot);
+}
+
+/**
+ * probe_reserve - Makes room in a table for more used slots
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @nb: Number of slots about to be used
+ *
+ * Description: Once it succeeded, probe_claim() can no longer fail for the
+ * nb next insertions.
+ *
+ * Return: 0 on success, -1 on failure, the table being untouched
+*/
+int probe_reserve(probe_table_t *table, probe_ops_t const *ops, size_t nb)
+{
+	/* Keep at least half of the slots empty, so probe sequences stay short */
+	if ((table->size + table->deleted + nb) * 2 <= table->capacity)
+		return (0);
+
+	return (probe_rehash(table, ops, table->size + nb));
+}
+
+/**
+ * probe_rehash - Moves the used slots of a table to a new table, dropping
+ *				  the deleted ones
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @min_size: Number of slots the new table must hold at half load
+ *
+ * Return: 0 on success, -1 on failure, the table being untouched
+*/
+int probe_rehash(probe_table_t *table, probe_ops_t const *ops,
+				 size_t min_size)
+{
+	probe_table_t grown = {0};
+	size_t i, j;
+	void *slot;
+
+	grown.capacity = PROBE_MIN_CAPACITY;
+	while (grown.capacity < min_size * 2)
+		grown.capacity *= 2;
+	grown.slots = calloc(grown.capacity, ops->slot_size);
+	if (!grown.slots)
+		return (-1);
+
+	for (i = 0; i < table->capacity; i++)
+	{
+		slot = probe_at(table, ops, i);
+		if (ops->state(slot) != PROBE_USED)
+			continue;
+		j = ops->hash(slot) & (grown.capacity - 1);
+		while (ops->state(probe_at(&grown, ops, j)) != PROBE_EMPTY)
+			j = (j + 1) & (grown.capacity - 1);
+		memcpy(probe_at(&grown, ops, j), slot, ops->slot_size);
+	}
+
+	grown.size = table->size;
+	free(table->slots);
+	*table = grown;
+	return (0);
+}
+
+/**
+ * probe_clear - Empties a table and releases its slots
+ * @table: Pointer to the table, ready to be reused
+*/
+void probe_clear(probe_table_t *table)
+{
+	if (!table)
+		return;
+
+	free(table->slots);
+	table->slots = NULL;
+	table->capacity = 0, table->size = 0, table->deleted = 0;
+}
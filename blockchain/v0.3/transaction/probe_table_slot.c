@@ -0,0 +1,75 @@
+#include "transaction.h"
+
+/**
+ * probe_lookup - Finds the used slot holding a key
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @hash: Hash of the key
+ * @match: Tells whether a used slot holds the key
+ * @key: Key to look for, passed to match
+ *
+ * Return: Number of the slot, or table->capacity if the key is not in the
+ *		   table
+*/
+size_t probe_lookup(probe_table_t const *table, probe_ops_t const *ops,
+					size_t hash, probe_match_t match, void const *key)
+{
+	size_t i;
+
+	if (!table->capacity)
+		return (0);
+
+	i = probe_find(table, ops, hash, match, key);
+	if (ops->state(probe_at(table, ops, i)) != PROBE_USED)
+		return (table->capacity);
+
+	return (i);
+}
+
+/**
+ * probe_get - Finds the used slot holding a key
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table
+ * @hash: Hash of the key
+ * @match: Tells whether a used slot holds the key
+ * @key: Key to look for, passed to match
+ *
+ * Return: Pointer to the slot, or NULL if the key is not in the table
+*/
+void *probe_get(probe_table_t const *table, probe_ops_t const *ops,
+				size_t hash, probe_match_t match, void const *key)
+{
+	size_t i = probe_lookup(table, ops, hash, match, key);
+
+	return (i < table->capacity ? probe_at(table, ops, i) : NULL);
+}
+
+/**
+ * probe_claim - Counts an empty or deleted slot as used
+ * @table: Pointer to the table, with room reserved by probe_reserve()
+ * @ops: How to read the slots of table
+ * @i: Slot returned by probe_find() for a key not in the table
+ *
+ * Return: Pointer to the slot, to be filled by the caller
+*/
+void *probe_claim(probe_table_t *table, probe_ops_t const *ops, size_t i)
+{
+	void *slot = probe_at(table, ops, i);
+
+	if (ops->state(slot) == PROBE_DELETED)
+		table->deleted--;
+	table->size++;
+	return (slot);
+}
+
+/**
+ * probe_release - Marks a used slot as deleted
+ * @table: Pointer to the table
+ * @ops: How to read the slots of table, with a bury function
+ * @i: Number of the used slot
+*/
+void probe_release(probe_table_t *table, probe_ops_t const *ops, size_t i)
+{
+	ops->bury(probe_at(table, ops, i));
+	table->size--, table->deleted++;
+}
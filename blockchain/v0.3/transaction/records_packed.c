@@ -0,0 +1,29 @@
+#include "transaction.h"
+
+/**
+ * records_packed - Checks whether a list of records still is the array
+ *					it was packed into
+ * @list: Pointer to the list
+ * @array: Array the list was packed into, or NULL
+ * @nb: Number of records in @array, -1 if the list was never packed
+ * @size: Size of a record
+ *
+ * Description: The list must have as many nodes as the array, its first
+ * node must be the first record of the array and its last node the last
+ * one. Counting the nodes alone would miss a node removed and another one
+ * added. Records can only be added at either end of a packed list or
+ * removed from it, not replaced in the middle.
+ *
+ * Return: 1 if the records can be read from the array, 0 otherwise
+*/
+int records_packed(llist_t *list, void const *array, int32_t nb, size_t size)
+{
+	if (nb < 0 || nb != llist_size(list))
+		return (0);
+	if (nb == 0)
+		return (1);
+
+	return (llist_get_head(list) == array &&
+			(uint8_t const *)llist_get_tail(list) ==
+			(uint8_t const *)array + (size_t)(nb - 1) * size);
+}
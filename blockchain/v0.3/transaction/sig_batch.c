@@ -0,0 +1,36 @@
+#include "transaction.h"
+
+/**
+ * sig_batch_add - Adds a signature to verify to a batch
+ * @batch: Pointer to the batch to update
+ * @pub: Public key the signature must be verified with
+ * @tx_id: ID of the signed transaction, must outlive the batch
+ * @sig: Signature to verify, must outlive the batch
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int sig_batch_add(sig_batch_t *batch, uint8_t const pub[EC_PUB_LEN],
+				  uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+				  sig_t const *sig)
+{
+	ec_verify_item_t *items, *item;
+
+	if (!batch || !pub || !tx_id || !sig)
+		return (-1);
+
+	if (batch->size == batch->capacity)
+	{
+		items = realloc(batch->items, (batch->capacity * 2 + 16) *
+						sizeof(*items));
+		if (!items)
+			return (-1);
+		batch->items = items, batch->capacity = batch->capacity * 2 + 16;
+	}
+
+	item = &batch->items[batch->size++];
+	memcpy(item->pub, pub, EC_PUB_LEN);
+	item->msg = tx_id, item->msglen = SHA256_DIGEST_LENGTH;
+	item->sig = sig;
+
+	return (0);
+}
@@ -0,0 +1,65 @@
+#include "transaction.h"
+
+/* Defined in spent_set_ops.c */
+int spent_outpoint_is(void const *slot, void const *key);
+
+/**
+ * spent_set_add - Records the output spent by an input
+ * @set: Pointer to the set to update
+ * @in: Input spending the output, must outlive the set
+ * @utxo: Unspent output referenced by in, may be NULL
+ *
+ * Return: 1 if the output was added, 0 if it is already spent by another
+ *		   input of the set, -1 on failure
+*/
+int spent_set_add(spent_set_t *set, tx_in_t const *in, utxo_t *utxo)
+{
+	spent_outpoint_t *slot;
+	size_t i;
+
+	if (!set || !in)
+		return (-1);
+
+	if (probe_reserve(&set->table, &spent_set_ops, 1) == -1)
+		return (-1);
+
+	i = probe_find(&set->table, &spent_set_ops,
+				   utxo_index_hash(in->tx_id, in->tx_out_hash),
+				   spent_outpoint_is, in);
+	slot = probe_at(&set->table, &spent_set_ops, i);
+	if (slot->in)
+		return (0);
+
+	slot = probe_claim(&set->table, &spent_set_ops, i);
+	slot->in = in, slot->utxo = utxo;
+	return (1);
+}
+
+/**
+ * spent_set_find - Finds an input of the set spending the same output as in
+ * @set: Pointer to the set to search
+ * @in: Input referencing the output to look for
+ *
+ * Return: Pointer to the matching entry, or NULL if the output is not spent
+*/
+spent_outpoint_t *spent_set_find(spent_set_t const *set, tx_in_t const *in)
+{
+	if (!set || !in)
+		return (NULL);
+
+	return (probe_get(&set->table, &spent_set_ops,
+					  utxo_index_hash(in->tx_id, in->tx_out_hash),
+					  spent_outpoint_is, in));
+}
+
+/**
+ * spent_set_clear - Empties a set and releases its table
+ * @set: Pointer to the set to empty, ready to be reused
+*/
+void spent_set_clear(spent_set_t *set)
+{
+	if (!set)
+		return;
+
+	probe_clear(&set->table);
+}
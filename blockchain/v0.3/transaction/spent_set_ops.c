@@ -0,0 +1,53 @@
+#include "transaction.h"
+
+/* Defined after */
+int spent_outpoint_state(void const *slot);
+size_t spent_outpoint_hash(void const *slot);
+
+probe_ops_t const spent_set_ops = {
+	sizeof(spent_outpoint_t), spent_outpoint_state, spent_outpoint_hash, NULL
+};
+
+/**
+ * spent_outpoint_state - Tells whether a slot of a spent set is used
+ * @slot: void pointer to the spent_outpoint_t
+ *
+ * Return: PROBE_USED if the slot holds an input, PROBE_EMPTY otherwise
+*/
+int spent_outpoint_state(void const *slot)
+{
+	return (((spent_outpoint_t const *) slot)->in ? PROBE_USED : PROBE_EMPTY);
+}
+
+/**
+ * spent_outpoint_hash - Computes the hash of the output spent by the input
+ *						 of a slot
+ * @slot: void pointer to the used spent_outpoint_t
+ *
+ * Return: Hash table key, see utxo_index_hash()
+*/
+size_t spent_outpoint_hash(void const *slot)
+{
+	tx_in_t const *in = ((spent_outpoint_t const *) slot)->in;
+
+	return (utxo_index_hash(in->tx_id, in->tx_out_hash));
+}
+
+/**
+ * spent_outpoint_is - Checks whether the input of a slot spends the output
+ *					   referenced by another input
+ * @slot: void pointer to the used spent_outpoint_t
+ * @key: void pointer to the tx_in_t referencing the output
+ *
+ * Return: 1 if both inputs reference the same output, 0 otherwise
+*/
+int spent_outpoint_is(void const *slot, void const *key)
+{
+	tx_in_t const *other = ((spent_outpoint_t const *) slot)->in;
+	tx_in_t const *in = key;
+
+	return (!memcmp(other->tx_out_hash, in->tx_out_hash,
+					SHA256_DIGEST_LENGTH) &&
+			!memcmp(other->tx_id, in->tx_id, SHA256_DIGEST_LENGTH) &&
+			!memcmp(other->block_hash, in->block_hash, SHA256_DIGEST_LENGTH));
+}
@@ -0,0 +1,34 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "transaction.h"
+
+/**
+ * _give_coins - Adds a mock unspent output sending amount to owner
+ *
+ * @all_unspent: List of unspent outputs to add the output to
+ * @index: Hash index of all_unspent
+ * @owner: Key owning the output
+ * @amount: Amount of the output
+ * @tx: Name of the mock transaction, hashed into its ID
+ *
+ * Return: Pointer to the unspent output
+ */
+utxo_t *_give_coins(llist_t *all_unspent, utxo_index_t *index,
+	EC_KEY *owner, uint32_t amount, char const *tx)
+{
+	uint8_t block_hash[SHA256_DIGEST_LENGTH];
+	uint8_t transaction_id[SHA256_DIGEST_LENGTH];
+	uint8_t pub[EC_PUB_LEN];
+	unspent_tx_out_t *unspent;
+	tx_out_t *out;
+
+	sha256((int8_t *)"Block", strlen("Block"), block_hash);
+	sha256((int8_t *)tx, strlen(tx), transaction_id);
+	out = tx_out_create(amount, ec_to_pub(owner, pub));
+	unspent = unspent_tx_out_create(block_hash, transaction_id, out);
+	llist_add_node(all_unspent, unspent, ADD_NODE_REAR);
+	utxo_index_add(index, unspent);
+	free(out);
+	return (unspent);
+}
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hblk_crypto.h"
+#include "transaction.h"
+
+/**
+ * _count_chunks - Counts the chunks of an arena
+ *
+ * @arena: Pointer to the arena
+ *
+ * Return: Number of chunks
+ */
+static int _count_chunks(arena_t const *arena)
+{
+	arena_chunk_t const *chunk;
+	int nb = 0;
+
+	for (chunk = arena->chunk; chunk; chunk = chunk->prev)
+		nb++;
+	return (nb);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	arena_t *arena;
+	uint8_t *ptrs[1000];
+	EC_KEY *receiver;
+	transaction_t *coinbase;
+	size_t i, j;
+	int zeroed = 1, aligned = 1, intact = 1;
+
+	arena = arena_create(64);
+	for (i = 0; i < 1000; i++)
+	{
+		ptrs[i] = arena_alloc(arena, 1 + i % 100);
+		for (j = 0; j < 1 + i % 100; j++)
+			zeroed &= ptrs[i][j] == 0;
+		aligned &= ((size_t)ptrs[i] % ARENA_ALIGN) == 0;
+		memset(ptrs[i], (int)(i & 0xff), 1 + i % 100);
+	}
+	for (i = 0; i < 1000; i++)
+		for (j = 0; j < 1 + i % 100; j++)
+			intact &= ptrs[i][j] == (i & 0xff);
+	printf("Zeroed: %d, aligned: %d, intact: %d, chunks: %d\n",
+		   zeroed, aligned, intact, _count_chunks(arena));
+
+	/* A big allocation gets a chunk of its own */
+	ptrs[0] = arena_alloc(arena, 1 << 20);
+	printf("Big allocation: %d, chunks: %d\n", ptrs[0] != NULL,
+		   _count_chunks(arena));
+	arena_destroy(arena);
+
+	receiver = ec_create();
+	arena = arena_create(1024);
+	coinbase = coinbase_create_in(arena, receiver, 1);
+	printf("Coinbase in arena: %d, valid: %d, chunks: %d\n",
+		   coinbase->arena == arena, coinbase_is_valid(coinbase, 1),
+		   _count_chunks(arena));
+	transaction_destroy(coinbase);
+	arena_destroy(arena);
+
+	coinbase = coinbase_create_in(NULL, receiver, 1);
+	printf("Coinbase on the heap: %d, valid: %d\n",
+		   coinbase->arena == NULL, coinbase_is_valid(coinbase, 1));
+	transaction_destroy(coinbase);
+
+	EC_KEY_free(receiver);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,98 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "transaction.h"
+
+utxo_t *_give_coins(llist_t *all_unspent, utxo_index_t *index,
+	EC_KEY *owner, uint32_t amount, char const *tx);
+
+#define NB_COINBASES 10000
+
+/**
+ * _print_selection - Prints the amounts of the outputs picked by a coin
+ *                    selection strategy
+ */
+static void _print_selection(char const *name, coin_select_t select,
+	utxo_address_t const *address, uint32_t amount)
+{
+	utxo_t **selected = malloc(address->size * sizeof(*selected));
+	size_t nb, i;
+
+	nb = select(address->utxos, address->size, amount, selected);
+	printf("%s(%u): %lu inputs [", name, amount, (unsigned long)nb);
+	for (i = 0; i < nb; i++)
+		printf("%s%u", i ? ", " : "", selected[i]->out.amount);
+	printf("]\n");
+	free(selected);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	uint32_t amounts[] = {1, 50, 20, 13, 7, 50, 3};
+	uint8_t pub[EC_PUB_LEN];
+	EC_KEY *sender, *receiver, *miner;
+	llist_t *all_unspent;
+	utxo_index_t *index;
+	utxo_address_t *address;
+	transaction_t *transaction;
+	char name[32];
+	unsigned int i;
+
+	sender = ec_create();
+	receiver = ec_create();
+	miner = ec_create();
+	all_unspent = llist_create(MT_SUPPORT_FALSE);
+	index = utxo_index_create(all_unspent);
+
+	for (i = 0; i < sizeof(amounts) / sizeof(*amounts); i++)
+	{
+		sprintf(name, "Transaction %u", i);
+		_give_coins(all_unspent, index, sender, amounts[i], name);
+	}
+	address = utxo_index_address(index, ec_to_pub(sender, pub));
+
+	_print_selection("largest_first", coin_select_largest_first, address, 63);
+	_print_selection("bnb", coin_select_bnb, address, 63);
+	_print_selection("bnb", coin_select_bnb, address, 144);
+	_print_selection("bnb", coin_select_bnb, address, 145);
+	_print_selection("smallest_sufficient", coin_select_smallest_sufficient,
+		address, 15);
+	_print_selection("smallest_sufficient", coin_select_smallest_sufficient,
+		address, 60);
+	_print_selection("default", coin_select_default, address, 63);
+	_print_selection("default", coin_select_default, address, 64);
+	_print_selection("default", coin_select_default, address, 145);
+
+	transaction = transaction_create_select(sender, receiver, 21, index,
+		coin_select_bnb);
+	printf("Transaction of 21: %d inputs, %d outputs, valid: %d\n",
+		llist_size(transaction->inputs), llist_size(transaction->outputs),
+		transaction_is_valid_indexed(transaction, index));
+	transaction_destroy(transaction);
+
+	/* A miner owning many coinbases only signs the inputs it needs */
+	for (i = 0; i < NB_COINBASES; i++)
+	{
+		sprintf(name, "Coinbase %u", i);
+		_give_coins(all_unspent, index, miner, COINBASE_AMOUNT, name);
+	}
+	transaction = transaction_create_indexed(miner, receiver, 120, index);
+	printf("Transaction of 120 from %d coinbases: %d inputs, valid: %d\n",
+		NB_COINBASES, llist_size(transaction->inputs),
+		transaction_is_valid_indexed(transaction, index));
+	transaction_destroy(transaction);
+
+	/* Cleanup */
+	EC_KEY_free(sender);
+	EC_KEY_free(receiver);
+	EC_KEY_free(miner);
+	utxo_index_destroy(index);
+	llist_destroy(all_unspent, 1, free);
+	return (EXIT_SUCCESS);
+}
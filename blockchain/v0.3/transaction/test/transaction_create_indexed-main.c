@@ -0,0 +1,59 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "transaction.h"
+
+void _transaction_print(transaction_t const *transaction);
+utxo_t *_give_coins(llist_t *all_unspent, utxo_index_t *index,
+	EC_KEY *owner, uint32_t amount, char const *tx);
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	uint8_t pub[EC_PUB_LEN];
+	EC_KEY *sender, *receiver, *other;
+	llist_t *all_unspent;
+	utxo_index_t *index;
+	utxo_address_t *address;
+	transaction_t *transaction;
+
+	sender = ec_create();
+	receiver = ec_create();
+	other = ec_create();
+	all_unspent = llist_create(MT_SUPPORT_FALSE);
+	index = utxo_index_create(all_unspent);
+
+	/* Coins of another address must not be spent */
+	_give_coins(all_unspent, index, other, 1000, "Transaction 0");
+	_give_coins(all_unspent, index, sender, 472, "Transaction 1");
+	_give_coins(all_unspent, index, other, 1000, "Transaction 2");
+	_give_coins(all_unspent, index, sender, 500, "Transaction 3");
+
+	address = utxo_index_address(index, ec_to_pub(sender, pub));
+	printf("Sender: %lu outputs, balance %lu\n", address->size,
+		(unsigned long)address->balance);
+	address = utxo_index_address(index, ec_to_pub(receiver, pub));
+	printf("Receiver known: %d\n", address != NULL);
+
+	/* Not enough coins */
+	transaction = transaction_create_indexed(sender, receiver, 973, index);
+	printf("Transaction of 973: %p\n", (void *)transaction);
+
+	transaction = transaction_create_indexed(sender, receiver, 500, index);
+	_transaction_print(transaction);
+	printf("Valid: %d\n", transaction_is_valid_indexed(transaction, index));
+
+	/* Cleanup */
+	EC_KEY_free(sender);
+	EC_KEY_free(receiver);
+	EC_KEY_free(other);
+	transaction_destroy(transaction);
+	utxo_index_destroy(index);
+	llist_destroy(all_unspent, 1, free);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "hblk_crypto.h"
+#include "transaction.h"
+
+/**
+ * _sum_amount - Sums the amounts of outputs
+ *
+ * @node: Pointer to the output
+ * @idx: Index of the output
+ * @arg: Pointer to the sum
+ *
+ * Return: 0
+ */
+static int _sum_amount(llist_node_t node, unsigned int idx, void *arg)
+{
+	*(uint32_t *)arg += ((tx_out_t *)node)->amount;
+	return (0);
+	(void)idx;
+}
+
+/**
+ * _points_into - Checks that the nodes of a list point into an array
+ *
+ * @list: Pointer to the list
+ * @array: Pointer to the array
+ * @size: Size of a record of the array
+ *
+ * Return: 1 if every node points to its slot of the array, 0 otherwise
+ */
+static int _points_into(llist_t *list, void *array, size_t size)
+{
+	int i;
+
+	for (i = 0; i < llist_size(list); i++)
+		if (llist_get_node_at(list, i) != (uint8_t *)array + i * size)
+			return (0);
+	return (1);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	transaction_t *tx;
+	EC_KEY *owner;
+	uint8_t pub[EC_PUB_LEN], id[SHA256_DIGEST_LENGTH], *hash;
+	uint32_t sum = 0;
+	int i;
+
+	owner = ec_create();
+	tx = calloc(1, sizeof(*tx));
+	tx->inputs = llist_create(MT_SUPPORT_FALSE);
+	tx->outputs = llist_create(MT_SUPPORT_FALSE);
+	for (i = 1; i <= 10; i++)
+		llist_add_node(tx->outputs, tx_out_create(i, ec_to_pub(owner, pub)),
+					   ADD_NODE_REAR);
+	transaction_hash(tx, tx->id);
+	printf("Packed before: %d\n", TX_OUTPUTS_PACKED(tx));
+
+	transaction_pack(tx);
+	tx_outputs_for_each(tx, _sum_amount, &sum);
+	hash = transaction_hash(tx, id);
+	printf("Packed after: %d, outputs: %d, in array: %d, sum: %u\n",
+		   TX_OUTPUTS_PACKED(tx), tx->nb_outputs,
+		   _points_into(tx->outputs, tx->output_array, sizeof(tx_out_t)),
+		   sum);
+	printf("Same id: %d\n", hash && !memcmp(id, tx->id, sizeof(id)));
+
+	/* Appending to a packed list falls back to the list */
+	llist_add_node(tx->outputs, tx_out_create(45, pub), ADD_NODE_REAR);
+	sum = 0;
+	tx_outputs_for_each(tx, _sum_amount, &sum);
+	printf("Packed after append: %d, sum: %u\n", TX_OUTPUTS_PACKED(tx), sum);
+	transaction_pack(tx);
+	printf("Packed again: %d, outputs: %d, in array: %d\n",
+		   TX_OUTPUTS_PACKED(tx), tx->nb_outputs,
+		   _points_into(tx->outputs, tx->output_array, sizeof(tx_out_t)));
+
+	/* Same count, but a slot of the array is no longer in the list */
+	llist_pop(tx->outputs);
+	llist_add_node(tx->outputs, tx_out_create(100, pub), ADD_NODE_REAR);
+	sum = 0;
+	tx_outputs_for_each(tx, _sum_amount, &sum);
+	printf("Packed after pop and append: %d, outputs: %d, sum: %u\n",
+		   TX_OUTPUTS_PACKED(tx), llist_size(tx->outputs), sum);
+
+	transaction_destroy(tx);
+	EC_KEY_free(owner);
+	return (EXIT_SUCCESS);
+}
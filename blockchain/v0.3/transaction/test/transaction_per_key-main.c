@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "transaction.h"
+
+utxo_t *_give_coins(llist_t *all_unspent, utxo_index_t *index,
+	EC_KEY *owner, uint32_t amount, char const *tx);
+
+/**
+ * _count_sigs - Counts the inputs of a transaction holding a signature
+ */
+static int _count_sigs(transaction_t const *transaction)
+{
+	int i, nb = 0;
+
+	for (i = 0; i < llist_size(transaction->inputs); i++)
+		nb += ((tx_in_t *)llist_get_node_at(transaction->inputs, i))->sig.len
+			!= 0;
+	return (nb);
+}
+
+/**
+ * _two_signers - Creates a transaction spending an output of two keys,
+ *                signing only the input of the first one
+ */
+static transaction_t *_two_signers(EC_KEY *a, utxo_t *utxo_a, EC_KEY *b,
+	utxo_t *utxo_b, EC_KEY *receiver)
+{
+	transaction_t *transaction = calloc(1, sizeof(*transaction));
+	uint8_t pub[EC_PUB_LEN];
+
+	transaction->inputs = llist_create(MT_SUPPORT_FALSE);
+	transaction->outputs = llist_create(MT_SUPPORT_FALSE);
+	llist_add_node(transaction->inputs, tx_in_create(utxo_a), ADD_NODE_REAR);
+	llist_add_node(transaction->inputs, tx_in_create(utxo_b), ADD_NODE_REAR);
+	llist_add_node(transaction->outputs, tx_out_create(utxo_a->out.amount +
+		utxo_b->out.amount, ec_to_pub(receiver, pub)), ADD_NODE_REAR);
+	transaction_hash(transaction, transaction->id);
+	ec_sign(a, transaction->id, SHA256_DIGEST_LENGTH,
+		&((tx_in_t *)llist_get_head(transaction->inputs))->sig);
+	(void)b;
+	return (transaction);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	EC_KEY *sender, *receiver, *other;
+	llist_t *all_unspent;
+	utxo_index_t *index;
+	transaction_t *transaction;
+	utxo_t *utxo_sender, *utxo_other;
+	tx_in_t *first, *second;
+	sig_batch_t batch = {NULL, 0, 0};
+	sig_t sig;
+
+	sender = ec_create();
+	receiver = ec_create();
+	other = ec_create();
+	all_unspent = llist_create(MT_SUPPORT_FALSE);
+	index = utxo_index_create(all_unspent);
+
+	utxo_sender = _give_coins(all_unspent, index, sender, 30, "Transaction 0");
+	_give_coins(all_unspent, index, sender, 40, "Transaction 1");
+	_give_coins(all_unspent, index, sender, 50, "Transaction 2");
+	utxo_other = _give_coins(all_unspent, index, other, 10, "Transaction 3");
+
+	/* Three inputs of the same key, one signature */
+	transaction = transaction_create_indexed(sender, receiver, 110, index);
+	printf("Inputs: %d, signatures: %d, version: %d\n",
+		llist_size(transaction->inputs), _count_sigs(transaction),
+		transaction_version(transaction));
+	printf("Valid: %d, with the list: %d\n",
+		transaction_is_valid_indexed(transaction, index),
+		transaction_is_valid(transaction, all_unspent));
+	printf("Deferred: %d\n",
+		transaction_is_valid_deferred(transaction, index, &batch));
+	printf("Signatures to verify: %lu, verified: %d\n",
+		(unsigned long)batch.size,
+		ec_verify_parallel(batch.items, batch.size, 1, NULL));
+
+	/* Each input may still hold its own signature */
+	first = llist_get_node_at(transaction->inputs, 0);
+	second = llist_get_node_at(transaction->inputs, 1);
+	second->sig = first->sig;
+	printf("Signature copied: %d, version: %d\n",
+		transaction_is_valid_indexed(transaction, index),
+		transaction_version(transaction));
+	second->sig.sig[4] ^= 1;
+	printf("Copied signature altered: %d\n",
+		transaction_is_valid_indexed(transaction, index));
+
+	/* An empty signature must follow one of the same key */
+	sig = first->sig;
+	memset(&first->sig, 0, sizeof(first->sig));
+	memset(&second->sig, 0, sizeof(second->sig));
+	printf("No signature: %d\n",
+		transaction_is_valid_indexed(transaction, index));
+	first->sig = sig;
+	transaction_destroy(transaction);
+
+	/* A signature does not cover the inputs of another key */
+	transaction = _two_signers(sender, utxo_sender, other, utxo_other,
+		receiver);
+	printf("Other key unsigned: %d\n",
+		transaction_is_valid_indexed(transaction, index));
+	second = llist_get_node_at(transaction->inputs, 1);
+	ec_sign(other, transaction->id, SHA256_DIGEST_LENGTH, &second->sig);
+	printf("Other key signed: %d\n",
+		transaction_is_valid_indexed(transaction, index));
+	transaction_destroy(transaction);
+
+	/* Cleanup */
+	free(batch.items);
+	EC_KEY_free(sender);
+	EC_KEY_free(receiver);
+	EC_KEY_free(other);
+	utxo_index_destroy(index);
+	llist_destroy(all_unspent, 1, free);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,86 @@
+/* Description: Index many coinbase outputs, then spend some of them */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "transaction.h"
+
+#define NB_COINBASES 1000
+
+/**
+ * _add_coinbases - Applies NB_COINBASES Blocks holding only a coinbase
+ */
+static llist_t *_add_coinbases(llist_t *all_unspent, utxo_index_t *index,
+	EC_KEY *miner)
+{
+	uint8_t block_hash[SHA256_DIGEST_LENGTH] = {0};
+	transaction_t *coinbase;
+	llist_t *transactions;
+	uint32_t i;
+
+	for (i = 0; i < NB_COINBASES; i++)
+	{
+		memcpy(block_hash, &i, sizeof(i));
+		coinbase = coinbase_create(miner, i);
+		transactions = llist_create(MT_SUPPORT_FALSE);
+		llist_add_node(transactions, coinbase, ADD_NODE_REAR);
+		all_unspent = update_unspent_indexed(transactions, block_hash,
+			all_unspent, index);
+		llist_destroy(transactions, 1, (node_dtor_t)transaction_destroy);
+	}
+	return (all_unspent);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	uint8_t block_hash[SHA256_DIGEST_LENGTH] = {42};
+	llist_t *all_unspent, *transactions;
+	utxo_index_t *index;
+	transaction_t *transaction;
+	EC_KEY *miner, *receiver;
+	tx_in_t *in;
+
+	miner = ec_create();
+	receiver = ec_create();
+	all_unspent = llist_create(MT_SUPPORT_FALSE);
+	index = utxo_index_create(all_unspent);
+
+	all_unspent = _add_coinbases(all_unspent, index, miner);
+	printf("Indexed: %lu, listed: %d\n", index->outputs.size, llist_size(all_unspent));
+
+	transaction = transaction_create(miner, receiver, 120, all_unspent);
+	in = llist_get_head(transaction->inputs);
+	printf("Found spent output: %d\n", utxo_index_find(index, in) != NULL);
+	printf("Signed with index: %d\n",
+		tx_in_sign_indexed(in, transaction->id, miner, index) != NULL);
+	printf("Signed by stranger: %d\n",
+		tx_in_sign_indexed(in, transaction->id, receiver, index) != NULL);
+	printf("Valid (list): %d\n", transaction_is_valid(transaction, all_unspent));
+	printf("Valid (index): %d\n",
+		transaction_is_valid_indexed(transaction, index));
+
+	transactions = llist_create(MT_SUPPORT_FALSE);
+	llist_add_node(transactions, transaction, ADD_NODE_REAR);
+	all_unspent = update_unspent_indexed(transactions, block_hash,
+		all_unspent, index);
+	printf("Indexed: %lu, listed: %d\n", index->outputs.size, llist_size(all_unspent));
+	printf("Found spent output: %d\n", utxo_index_find(index, in) != NULL);
+	printf("Valid again (list): %d\n",
+		transaction_is_valid(transaction, all_unspent));
+	printf("Valid again (index): %d\n",
+		transaction_is_valid_indexed(transaction, index));
+
+	llist_destroy(transactions, 1, (node_dtor_t)transaction_destroy);
+	llist_destroy(all_unspent, 1, NULL);
+	utxo_index_destroy(index);
+	EC_KEY_free(miner);
+	EC_KEY_free(receiver);
+
+	return (EXIT_SUCCESS);
+}
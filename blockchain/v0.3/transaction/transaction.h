@@ -6,6 +6,39 @@
 
 #define COINBASE_AMOUNT 50
 
+/* Alignment of every allocation made from an arena */
+#define ARENA_ALIGN 16
+#define ARENA_ROUND(size) \
+	(((size) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+/**
+ * struct arena_chunk_s - Memory area allocations of an arena are made from
+ *
+ * @prev: Chunk allocated before this one, or NULL
+ * @size: Number of bytes usable after the header of the chunk
+ * @used: Number of bytes already allocated
+ */
+typedef struct arena_chunk_s
+{
+	struct arena_chunk_s *prev;
+	size_t size;
+	size_t used;
+} arena_chunk_t;
+
+/**
+ * struct arena_s - Bump allocator, whose allocations are all freed at once
+ *
+ * Description: The arena itself lives in its first chunk. Each new chunk
+ * is at least twice as big as the previous one, so that a few chunks are
+ * enough whatever the number of allocations.
+ *
+ * @chunk: Chunk the next allocations are made from
+ */
+typedef struct arena_s
+{
+	arena_chunk_t *chunk;
+} arena_t;
+
 /**
  * struct transaction_s - Transaction structure
  *
@@ -13,14 +46,51 @@
  *           Prevents further alteration of the transaction.
  * @inputs:  List of `tx_in_t *`. Transaction inputs
  * @outputs: List of `tx_out_t *`. Transaction outputs
+ * @mapped:  1 if the inputs point into a memory-mapped Blockchain file,
+ *           in which case they are not freed with the transaction
+ * @arena:   Arena the transaction, its outputs and its inputs not mapped
+ *           are allocated from, in which case they are freed with the
+ *           arena, or NULL if they are allocated one by one
+ * @input_array:  Contiguous array @inputs points into, or NULL
+ * @nb_inputs:    Number of inputs in @input_array
+ * @output_array: Contiguous array @outputs points into, or NULL
+ * @nb_outputs:   Number of outputs in @output_array
+ *
+ * Description: Once packed by transaction_pack(), the inputs and outputs
+ * are read from their arrays by tx_inputs_for_each() and
+ * tx_outputs_for_each(). The lists still point to each of them; once a
+ * record is added to or removed from a list, it is read from the list
+ * until packed again, see records_packed().
  */
 typedef struct transaction_s
 {
 	uint8_t id[SHA256_DIGEST_LENGTH];
 	llist_t *inputs;
 	llist_t *outputs;
+	int mapped;
+	arena_t *arena;
+	struct tx_in_s *input_array;
+	int32_t nb_inputs;
+	struct tx_out_s *output_array;
+	int32_t nb_outputs;
 } transaction_t;
 
+/*
+ * Each input of a TX_VERSION_PER_INPUT transaction holds its own signature.
+ * In a TX_VERSION_PER_KEY transaction, an input with an empty signature is
+ * covered by the signature of an earlier input spending an output of the
+ * same public key, so the transaction holds one signature per key.
+ */
+#define TX_VERSION_PER_INPUT 0
+#define TX_VERSION_PER_KEY 1
+
+/* 1 if the inputs of a transaction are read from its input array */
+#define TX_INPUTS_PACKED(tx) records_packed((tx)->inputs, (tx)->input_array, \
+	(tx)->nb_inputs, sizeof(tx_in_t))
+/* 1 if the outputs of a transaction are read from its output array */
+#define TX_OUTPUTS_PACKED(tx) records_packed((tx)->outputs, \
+	(tx)->output_array, (tx)->nb_outputs, sizeof(tx_out_t))
+
 /**
  * struct tx_out_s - Transaction output
  *
@@ -54,6 +124,146 @@ typedef struct unspent_tx_out_s
 
 typedef unspent_tx_out_t utxo_t;
 
+/**
+ * struct utxo_address_s - Unspent transaction outputs owned by an address
+ *
+ * @pub:      Public key of the address
+ * @utxos:    Array of @size unspent outputs sent to @pub, in no particular
+ *            order
+ * @size:     Number of unspent outputs in @utxos
+ * @capacity: Number of unspent outputs @utxos can hold
+ * @balance:  Total amount of the unspent outputs in @utxos
+ */
+typedef struct utxo_address_s
+{
+	uint8_t pub[EC_PUB_LEN];
+	utxo_t **utxos;
+	size_t size;
+	size_t capacity;
+	uint64_t balance;
+} utxo_address_t;
+
+/* States of a slot of a probe_table_t */
+#define PROBE_EMPTY 0
+#define PROBE_USED 1
+#define PROBE_DELETED 2
+
+/* Minimum number of slots of a probe_table_t */
+#define PROBE_MIN_CAPACITY 16
+
+/**
+ * struct probe_table_s - Open-addressing hash table, using linear probing
+ *
+ * Description: The slots are opaque to the table, a probe_ops_t tells how
+ * to read them. A slot filled with zeros is always empty. At least half of
+ * the slots are kept empty, so probe sequences stay short.
+ *
+ * @slots:    Table of @capacity slots, NULL if never used
+ * @capacity: Number of slots, always a power of 2, 0 until the first use
+ * @size:     Number of used slots
+ * @deleted:  Number of deleted slots, reused by the next insertions and
+ *            dropped when the table is rehashed
+ */
+typedef struct probe_table_s
+{
+	void *slots;
+	size_t capacity;
+	size_t size;
+	size_t deleted;
+} probe_table_t;
+
+/**
+ * struct probe_ops_s - How to read the slots of a probe_table_t
+ *
+ * @slot_size: Size of a slot in bytes
+ * @state:     Returns PROBE_EMPTY, PROBE_USED or PROBE_DELETED for a slot
+ * @hash:      Returns the hash of the key of a used slot
+ * @bury:      Marks a used slot as deleted, NULL if slots are never removed
+ */
+typedef struct probe_ops_s
+{
+	size_t slot_size;
+	int (*state)(void const *slot);
+	size_t (*hash)(void const *slot);
+	void (*bury)(void *slot);
+} probe_ops_t;
+
+/* Returns 1 if a used slot holds the given key, 0 otherwise */
+typedef int (*probe_match_t)(void const *slot, void const *key);
+
+/**
+ * struct utxo_slot_s - Slot of an index of unspent transaction outputs
+ *
+ * @utxo: Pointer to the indexed output, NULL for an empty slot,
+ *        UTXO_INDEX_TOMBSTONE for the slot of a removed output
+ * @pos:  Position of @utxo in the outputs of its address
+ */
+typedef struct utxo_slot_s
+{
+	utxo_t *utxo;
+	size_t pos;
+} utxo_slot_t;
+
+/**
+ * struct utxo_index_s - Hash index over a list of unspent transaction outputs
+ *
+ * Description: Hash table, see probe_table_t, of pointers to the utxo_t
+ * stored in a list of unspent outputs. Entries are keyed by the output they
+ * refer to (Block hash, transaction ID and output hash), exactly like a
+ * transaction input refers to it. The list keeps owning the utxo_t, the
+ * index only points to them.
+ *
+ * A second table, keyed by public key, groups the indexed outputs per
+ * address, so the coins of an address are found without scanning the others.
+ *
+ * @outputs:   Table of utxo_slot_t, its size is the number of indexed
+ *             unspent outputs
+ * @addresses: Table of utxo_address_t pointers, an address is never removed
+ */
+typedef struct utxo_index_s
+{
+	probe_table_t outputs;
+	probe_table_t addresses;
+} utxo_index_t;
+
+/* Marks a slot whose unspent output was removed from the index */
+extern utxo_t utxo_index_tombstone;
+#define UTXO_INDEX_TOMBSTONE (&utxo_index_tombstone)
+
+/* How to read the slots of the tables of a utxo_index_t */
+extern probe_ops_t const utxo_index_ops;
+extern probe_ops_t const utxo_address_ops;
+
+/**
+ * struct sig_batch_s - Input signatures collected to be verified together
+ *
+ * @items:    Array of @size signatures, each with the public key of the
+ *            spent output and the ID of the transaction it signs
+ * @size:     Number of signatures in @items
+ * @capacity: Number of signatures @items can hold
+ */
+typedef struct sig_batch_s
+{
+	ec_verify_item_t *items;
+	size_t size;
+	size_t capacity;
+} sig_batch_t;
+
+/**
+ * struct tx_signers_s - Public keys whose signature was checked, or added
+ *                       to a batch, while checking a transaction
+ *
+ * @pubs:     Array of @size public keys, pointing into the spent outputs
+ * @size:     Number of public keys in @pubs
+ * @capacity: Number of public keys @pubs can hold
+ */
+typedef struct tx_signers_s
+{
+	uint8_t const **pubs;
+	size_t size;
+	size_t capacity;
+} tx_signers_t;
+
 /**
  * struct tx_in_s - Transaction input
  *
@@ -76,10 +286,91 @@ typedef struct tx_in_s
 	sig_t sig;
 } tx_in_t;
 
+/**
+ * struct spent_outpoint_s - Output spent by an input of a Block
+ *
+ * @in:   Input spending the output
+ * @utxo: Unspent output referenced by @in, or NULL if it was not looked up
+ */
+typedef struct spent_outpoint_s
+{
+	tx_in_t const *in;
+	utxo_t *utxo;
+} spent_outpoint_t;
+
+/**
+ * struct spent_set_s - Set of the outputs spent by the inputs of a Block
+ *
+ * Description: Hash table, see probe_table_t, keyed like
+ * utxo_index_t by the referenced output (Block hash, transaction ID and
+ * output hash). Built while validating a Block, it rejects a second input
+ * spending the same output, and lists the outputs to remove once the Block
+ * is applied.
+ *
+ * @table: Table of spent_outpoint_t slots, a slot is empty while its
+ *         input is NULL
+ */
+typedef struct spent_set_s
+{
+	probe_table_t table;
+} spent_set_t;
+
+/* How to read the slots of a spent_set_t */
+extern probe_ops_t const spent_set_ops;
+
+/*
+ * Picks, among the @nb_utxos unspent outputs of a sender, those a
+ * transaction of @amount coins spends. @selected has room for @nb_utxos
+ * pointers. Returns the number of outputs picked, 0 if they cannot cover
+ * @amount.
+ */
+typedef size_t (*coin_select_t)(utxo_t * const *utxos, size_t nb_utxos,
+								uint32_t amount, utxo_t **selected);
+
+/* Maximum number of branches visited looking for an exact match */
+#define COIN_SELECT_BNB_MAX_TRIES 100000
+
+/**
+ * struct coin_search_s - State of a branch-and-bound coin selection
+ *
+ * @sorted:     Array of @nb candidates, sorted by decreasing amount
+ * @nb:         Number of candidates in @sorted
+ * @remaining:  @remaining[i] is the total amount of @sorted[i] onwards
+ * @target:     Amount to match exactly
+ * @current:    Indexes in @sorted of the @depth candidates of the branch
+ * @depth:      Number of candidates in the current branch
+ * @best:       Indexes in @sorted of the best match found
+ * @best_size:  Number of candidates of @best, matches must use fewer
+ * @tries:      Number of branches still allowed to be visited
+ */
+typedef struct coin_search_s
+{
+	utxo_t **sorted;
+	size_t nb;
+	uint64_t *remaining;
+	uint64_t target;
+	size_t *current;
+	size_t depth;
+	size_t *best;
+	size_t best_size;
+	unsigned long tries;
+} coin_search_t;
+
 
 /* Functions prototypes */
+arena_t *arena_create(size_t size);
+
+void *arena_alloc(arena_t *arena, size_t size);
+
+void arena_free(arena_t *arena, void *ptr);
+
+void arena_destroy(arena_t *arena);
+
 tx_out_t *tx_out_create(uint32_t amount, uint8_t const pub[EC_PUB_LEN]);
 
+tx_out_t *tx_out_create_in(arena_t *arena, uint32_t amount,
+						   uint8_t const pub[EC_PUB_LEN]);
+
 utxo_t *unspent_tx_out_create(uint8_t block_hash[SHA256_DIGEST_LENGTH],
 							  uint8_t tx_id[SHA256_DIGEST_LENGTH], tx_out_t const *out);
 
@@ -100,11 +391,157 @@ int transaction_is_valid(transaction_t const *transaction,
 
 transaction_t *coinbase_create(EC_KEY const *receiver, uint32_t block_index);
 
+transaction_t *coinbase_create_in(arena_t *arena, EC_KEY const *receiver,
+								  uint32_t block_index);
+
 int coinbase_is_valid(transaction_t const *coinbase, uint32_t block_index);
 
 void transaction_destroy(transaction_t *transaction);
+void records_destroy(llist_t *list, void *array, int32_t nb, size_t size,
+					 int owned);
+
+int transaction_pack(transaction_t *transaction);
+int records_packed(llist_t *list, void const *array, int32_t nb, size_t size);
+
+int tx_inputs_for_each(transaction_t const *transaction, node_func_t func,
+					   void *arg);
+
+int tx_outputs_for_each(transaction_t const *transaction, node_func_t func,
+						void *arg);
 
 llist_t *update_unspent(llist_t *transactions,
 						uint8_t block_hash[SHA256_DIGEST_LENGTH], llist_t *all_unspent);
 
+void *probe_at(probe_table_t const *table, probe_ops_t const *ops,
+			   size_t i);
+
+size_t probe_find(probe_table_t const *table, probe_ops_t const *ops,
+				  size_t hash, probe_match_t match, void const *key);
+
+size_t probe_lookup(probe_table_t const *table, probe_ops_t const *ops,
+					size_t hash, probe_match_t match, void const *key);
+
+void *probe_get(probe_table_t const *table, probe_ops_t const *ops,
+				size_t hash, probe_match_t match, void const *key);
+
+int probe_reserve(probe_table_t *table, probe_ops_t const *ops, size_t nb);
+
+int probe_rehash(probe_table_t *table, probe_ops_t const *ops,
+				 size_t min_size);
+
+void *probe_claim(probe_table_t *table, probe_ops_t const *ops, size_t i);
+
+void probe_release(probe_table_t *table, probe_ops_t const *ops, size_t i);
+
+void probe_clear(probe_table_t *table);
+
+utxo_index_t *utxo_index_create(llist_t *all_unspent);
+
+void utxo_index_destroy(utxo_index_t *index);
+
+int utxo_index_add(utxo_index_t *index, utxo_t *utxo);
+
+size_t utxo_index_hash(uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+					   uint8_t const out_hash[SHA256_DIGEST_LENGTH]);
+
+utxo_t *utxo_index_find(utxo_index_t const *index, tx_in_t const *in);
+
+utxo_t *utxo_index_remove(utxo_index_t *index, tx_in_t const *in);
+
+int utxo_index_remove_utxo(utxo_index_t *index, utxo_t const *utxo);
+
+size_t utxo_index_slot(utxo_index_t const *index, utxo_t const *utxo);
+
+void utxo_index_unset(utxo_index_t *index, size_t i);
+
+void utxo_index_unlist(utxo_index_t *index, llist_t *all_unspent,
+					   utxo_t *utxo);
+
+int utxo_slot_is(void const *slot, void const *key);
+
+int utxo_slot_holds(void const *slot, void const *key);
+
+utxo_address_t *utxo_index_address(utxo_index_t const *index,
+								   uint8_t const pub[EC_PUB_LEN]);
+
+int utxo_address_add(utxo_index_t *index, utxo_t *utxo, size_t *pos);
+
+void utxo_address_remove(utxo_index_t *index, utxo_t const *utxo, size_t pos);
+
+size_t utxo_pub_hash(uint8_t const pub[EC_PUB_LEN]);
+
+int utxo_address_is(void const *slot, void const *key);
+
+void utxo_address_destroy_all(utxo_index_t *index);
+
+uint8_t *utxo_commitment(llist_t *all_unspent,
+						 uint8_t hash_buf[SHA256_DIGEST_LENGTH]);
+
+transaction_t *transaction_create_indexed(EC_KEY const *sender,
+										  EC_KEY const *receiver,
+										  uint32_t amount,
+										  utxo_index_t const *index);
+
+transaction_t *transaction_create_select(EC_KEY const *sender,
+										 EC_KEY const *receiver,
+										 uint32_t amount,
+										 utxo_index_t const *index,
+										 coin_select_t select);
+
+size_t coin_select_largest_first(utxo_t * const *utxos, size_t nb_utxos,
+								 uint32_t amount, utxo_t **selected);
+
+size_t coin_select_smallest_sufficient(utxo_t * const *utxos,
+									   size_t nb_utxos, uint32_t amount,
+									   utxo_t **selected);
+
+size_t coin_select_bnb(utxo_t * const *utxos, size_t nb_utxos,
+					   uint32_t amount, utxo_t **selected);
+
+size_t coin_select_default(utxo_t * const *utxos, size_t nb_utxos,
+						   uint32_t amount, utxo_t **selected);
+
+size_t coin_select_exact(utxo_t * const *utxos, size_t nb_utxos,
+						 uint32_t amount, size_t max_inputs,
+						 utxo_t **selected);
+
+transaction_t *transaction_assemble(EC_KEY const *sender,
+									EC_KEY const *receiver, uint32_t amount,
+									utxo_t **selected_utxos, size_t nb_selected,
+									llist_t *all_unspent,
+									utxo_index_t const *index);
+
+int transaction_is_valid_indexed(transaction_t const *transaction,
+								 utxo_index_t const *index);
+
+int transaction_is_valid_deferred(transaction_t const *transaction,
+								  utxo_index_t const *index,
+								  sig_batch_t *batch);
+
+uint8_t transaction_version(transaction_t const *transaction);
+
+int tx_signers_find(tx_signers_t const *signers,
+					uint8_t const pub[EC_PUB_LEN]);
+
+int tx_signers_add(tx_signers_t *signers, uint8_t const pub[EC_PUB_LEN]);
+
+void tx_signers_clear(tx_signers_t *signers);
+
+int spent_set_add(spent_set_t *set, tx_in_t const *in, utxo_t *utxo);
+
+spent_outpoint_t *spent_set_find(spent_set_t const *set, tx_in_t const *in);
+
+void spent_set_clear(spent_set_t *set);
+
+int sig_batch_add(sig_batch_t *batch, uint8_t const pub[EC_PUB_LEN],
+				  uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+				  sig_t const *sig);
+
+sig_t *tx_in_sign_indexed(tx_in_t *in, uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+						  EC_KEY const *sender, utxo_index_t const *index);
+
+llist_t *update_unspent_indexed(llist_t *transactions,
+								uint8_t block_hash[SHA256_DIGEST_LENGTH],
+								llist_t *all_unspent, utxo_index_t *index);
+
 #endif /* TRANSACTION_H */
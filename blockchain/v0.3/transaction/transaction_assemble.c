@@ -0,0 +1,100 @@
+#include "transaction.h"
+
+/* Defined in transaction_create.c */
+int create_transaction_inputs(llist_t **inputs, utxo_t **selected_utxos,
+							  size_t nb_selected);
+int create_transaction_outputs(llist_t **outputs, size_t amount,
+							   size_t selected_utxos_amount, EC_KEY const *receiver,
+							   EC_KEY const *sender);
+/* Defined after */
+int sign_input(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * transaction_assemble - creates a transaction spending selected outputs
+ * @sender: contains the private key of the transaction sender
+ * @receiver: contains the public key of the receiver
+ * @amount: amount to send
+ * @selected_utxos: array of the unspent outputs of sender to spend
+ * @nb_selected: number of unspent outputs in selected_utxos
+ * @all_unspent: list of all the unspent outputs (utxo) to date, used to sign
+ *				 the inputs if index is NULL
+ * @index: hash index of all the unspent outputs to date, or NULL
+ *
+ * Description: The transaction is a TX_VERSION_PER_KEY transaction: all
+ * its inputs spend outputs of sender, so only the first one is signed.
+ *
+ * Return: pointer to the created transaction upon success,
+ * or NULL upon failure (e.g. the selected outputs are not enough)
+*/
+transaction_t *transaction_assemble(EC_KEY const *sender,
+									EC_KEY const *receiver, uint32_t amount,
+									utxo_t **selected_utxos, size_t nb_selected,
+									llist_t *all_unspent,
+									utxo_index_t const *index)
+{
+	transaction_t *transaction;
+	size_t selected_utxos_amount = 0, i;
+	void *arg[5] = {0};
+	int nb_signed = 0;
+
+	for (i = 0; i < nb_selected; i++)
+		selected_utxos_amount += selected_utxos[i]->out.amount;
+	/* If not enough amount, fails */
+	if (selected_utxos_amount < amount)
+		return (NULL);
+
+	/* Create transaction struct with the inputs and outputs*/
+	transaction = calloc(1, sizeof(*transaction));
+	if ((!transaction) ||
+		(create_transaction_inputs(&(transaction->inputs),
+		 selected_utxos, nb_selected) == -1) ||
+		(create_transaction_outputs(&(transaction->outputs), amount,
+		 selected_utxos_amount, receiver, sender) == -1))
+	{
+		free(transaction);
+		return (NULL);
+	}
+	transaction_hash(transaction, transaction->id);
+	arg[0] = transaction->id, arg[1] = (void *) sender, arg[2] = all_unspent;
+	arg[3] = (utxo_index_t *) index, arg[4] = &nb_signed;
+	llist_for_each(transaction->inputs, sign_input, arg);
+	return (transaction);
+}
+
+/**
+ * sign_input - function called by llist_for_each on transaction->inputs list
+ *				to sign the transactin inputs
+ * @node: contains the transaction input tx_in to sign
+ * @idx: index of the current node being processed, not used here
+ * @arg: contains the transaction id tx_id, the sender EC_KEY,
+ *		 the all_unspent list, its index (NULL to scan the list)
+ *		 and the number of inputs signed so far
+ * Return: 0 on success, -1 on failure
+*/
+int sign_input(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	tx_in_t *tx_in = (tx_in_t *) node;
+	uint8_t *tx_id = ptr[0];
+	EC_KEY const *sender = ptr[1];
+	llist_t *all_unspent = ptr[2];
+	utxo_index_t *index = ptr[3];
+	int *nb_signed = ptr[4];
+
+	/* The signature of the first input covers the next ones */
+	if (*nb_signed)
+	{
+		memset(&(tx_in->sig), 0, sizeof(tx_in->sig));
+		return (0);
+	}
+
+	if (index && !tx_in_sign_indexed(tx_in, tx_id, sender, index))
+		return (-1);
+
+	if (!index && !tx_in_sign(tx_in, tx_id, sender, all_unspent))
+		return (-1);
+
+	(*nb_signed)++;
+	idx = idx; /* Remove unused variable warning */
+	return (0);
+}
@@ -6,7 +6,6 @@ int create_transaction_inputs(llist_t **inputs, utxo_t **selected_utxos,
 int create_transaction_outputs(llist_t **outputs, size_t amount,
 							   size_t selected_utxos_amount, EC_KEY const *receiver,
 							   EC_KEY const *sender);
-int sign_input(llist_node_t node, unsigned int idx, void *arg);
 
 /**
  * transaction_create - creates a transaction
@@ -22,6 +21,9 @@ int sign_input(llist_node_t node, unsigned int idx, void *arg);
  *		*Select a set of unspent transaction outputs from all_unspent,
  *			which public keys match sender‘s private key.
  *
+ *		*Keep only the fewest of them covering amount
+ *			(see coin_select_default())
+ *
  *		*Create transaction inputs from these selected unspent transaction outputs
  *
  *		*The function fail if sender does not possess enough coins
@@ -42,8 +44,8 @@ transaction_t *transaction_create(EC_KEY const *sender, EC_KEY const *receiver,
 								uint32_t amount, llist_t *all_unspent)
 {
 	transaction_t *transaction;
-	utxo_t **selected_utxos = NULL;
-	size_t nb_selected = 0;
+	utxo_t **selected_utxos = NULL, **spent_utxos;
+	size_t nb_selected = 0, nb_spent;
 	size_t selected_utxos_amount = 0;
 	uint8_t sender_pub[EC_PUB_LEN];
 	void *arg[4] = {0};
@@ -59,27 +61,16 @@ transaction_t *transaction_create(EC_KEY const *sender, EC_KEY const *receiver,
 	arg[0] = sender_pub, arg[1] = selected_utxos;
 	arg[2] = &selected_utxos_amount, arg[3] = &nb_selected;
 	llist_for_each(all_unspent, select_utxo, arg);
-	/* If not enough amount, fails */
-	if (selected_utxos_amount < amount)
-	{
-		free(selected_utxos);
-		return (NULL);
-	}
-	/* Create transaction struct with the inputs and outputs*/
-	transaction = malloc(sizeof(*transaction));
-	if ((!transaction) ||
-		(create_transaction_inputs(&(transaction->inputs),
-		 selected_utxos, nb_selected) == -1) ||
-		(create_transaction_outputs(&(transaction->outputs), amount,
-		 selected_utxos_amount, receiver, sender) == -1))
-	{
-		free(selected_utxos), free(transaction);
-		return (NULL);
-	}
-	transaction_hash(transaction, transaction->id);
-	arg[0] = transaction->id, arg[1] = (void *) sender, arg[2] = all_unspent;
-	llist_for_each(transaction->inputs, sign_input, arg);
+
+	/* Only spend the outputs needed to cover amount */
+	spent_utxos = calloc(nb_selected + 1, sizeof(utxo_t *));
+	nb_spent = spent_utxos ? coin_select_default(selected_utxos, nb_selected,
+												 amount, spent_utxos) : 0;
+	transaction = nb_spent ? transaction_assemble(sender, receiver, amount,
+												  spent_utxos, nb_spent,
+												  all_unspent, NULL) : NULL;
 	free(selected_utxos);
+	free(spent_utxos);
 	return (transaction);
 }
 
@@ -192,27 +183,3 @@ int create_transaction_outputs(llist_t **outputs, size_t amount,
 
 	return (0);
 }
-
-/**
- * sign_input - function called by llist_for_each on transaction->inputs list
- *				to sign the transactin inputs
- * @node: contains the transaction input tx_in to sign
- * @idx: index of the current node being processed, not used here
- * @arg: contains the transaction id tx_id, the sender EC_KEY,
- *		 and the all_unspent list
- * Return: 0 on success, -1 on failure
-*/
-int sign_input(llist_node_t node, unsigned int idx, void *arg)
-{
-	void **ptr = arg;
-	tx_in_t *tx_in = (tx_in_t *) node;
-	uint8_t *tx_id = ptr[0];
-	EC_KEY const *sender = ptr[1];
-	llist_t *all_unspent = ptr[2];
-
-	if (!tx_in_sign(tx_in, tx_id, sender, all_unspent))
-		return (-1);
-
-	idx = idx; /* Remove unused variable warning */
-	return (0);
-}
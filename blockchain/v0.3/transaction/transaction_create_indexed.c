@@ -0,0 +1,70 @@
+#include "transaction.h"
+
+/**
+ * transaction_create_indexed - creates a transaction, using a hash index
+ *								of the unspent outputs
+ * @sender: contains the private key of the transaction sender
+ * @receiver: contains the public key of the receiver
+ * @amount: amount to send
+ * @index: hash index of all the unspent outputs (utxo) to date
+ *
+ * Description: Same as transaction_create(), but the unspent outputs of
+ * sender are taken from its address in the index, so the outputs of the
+ * other addresses are never looked at.
+ *
+ * Return: pointer to the created transaction upon success,
+ * or NULL upon failure
+*/
+transaction_t *transaction_create_indexed(EC_KEY const *sender,
+										  EC_KEY const *receiver,
+										  uint32_t amount,
+										  utxo_index_t const *index)
+{
+	return (transaction_create_select(sender, receiver, amount, index,
+									  coin_select_default));
+}
+
+/**
+ * transaction_create_select - creates a transaction spending the unspent
+ *							   outputs picked by a coin selection strategy
+ * @sender: contains the private key of the transaction sender
+ * @receiver: contains the public key of the receiver
+ * @amount: amount to send
+ * @index: hash index of all the unspent outputs (utxo) to date
+ * @select: strategy picking the outputs of sender to spend, e.g.
+ *			coin_select_largest_first(), coin_select_bnb(),
+ *			coin_select_smallest_sufficient() or coin_select_default()
+ *
+ * Return: pointer to the created transaction upon success,
+ * or NULL upon failure (e.g. the strategy found no outputs to spend)
+*/
+transaction_t *transaction_create_select(EC_KEY const *sender,
+										 EC_KEY const *receiver,
+										 uint32_t amount,
+										 utxo_index_t const *index,
+										 coin_select_t select)
+{
+	uint8_t sender_pub[EC_PUB_LEN];
+	utxo_address_t *address;
+	transaction_t *transaction = NULL;
+	utxo_t **selected;
+	size_t nb_selected;
+
+	if (!sender || !receiver || !index || !select ||
+		!ec_to_pub(sender, sender_pub))
+		return (NULL);
+
+	address = utxo_index_address(index, sender_pub);
+	if (!address || !address->size || address->balance < amount)
+		return (NULL);
+
+	selected = malloc(address->size * sizeof(*selected));
+	if (!selected)
+		return (NULL);
+	nb_selected = select(address->utxos, address->size, amount, selected);
+	if (nb_selected)
+		transaction = transaction_assemble(sender, receiver, amount, selected,
+										   nb_selected, NULL, index);
+	free(selected);
+	return (transaction);
+}
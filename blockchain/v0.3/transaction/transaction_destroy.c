@@ -1,17 +1,78 @@
 #include "transaction.h"
 
+/* Defined after */
+int record_free(llist_node_t node, unsigned int idx, void *arg);
+
 /**
  * transaction_destroy - Deallocates a transaction structure.
  * @transaction: Pointer to the transaction to delete
  *
  * The function frees the content of the transaction and the transaction itself
+ * Inputs pointing into a memory-mapped file are left to the mapping,
+ * a transaction allocated from an arena is left to the arena.
+ * Packed inputs and outputs are freed with their array.
 */
 void transaction_destroy(transaction_t *transaction)
 {
-	if (!transaction)
+	transaction_t *tx = transaction;
+	int owned;
+
+	if (!tx)
 		return;
 
-	llist_destroy(transaction->inputs, 1, NULL);
-	llist_destroy(transaction->outputs, 1, NULL);
-	free(transaction);
+	owned = !tx->arena;
+	records_destroy(tx->inputs, tx->input_array, tx->nb_inputs,
+					sizeof(tx_in_t), owned && !tx->mapped);
+	records_destroy(tx->outputs, tx->output_array, tx->nb_outputs,
+					sizeof(tx_out_t), owned);
+	arena_free(tx->arena, tx);
+}
+
+/**
+ * records_destroy - Deletes a list of inputs or outputs, and their array
+ * @list: Pointer to the list, may be NULL
+ * @array: Array packing the first records of the list, or NULL
+ * @nb: Number of records in @array
+ * @size: Size of a record
+ * @owned: 1 if the records and the array are allocated from the heap and
+ *		   must be freed, 0 if they are left to an arena or a mapping
+ *
+ * Description: Records appended to the list after it was packed are not in
+ * the array, and are freed one by one.
+*/
+void records_destroy(llist_t *list, void *array, int32_t nb, size_t size,
+					 int owned)
+{
+	void *arg[3];
+
+	arg[0] = array, arg[1] = &nb, arg[2] = &size;
+	if (owned && list)
+		llist_for_each(list, record_free, arg);
+	llist_destroy(list, 0, NULL);
+	if (owned)
+		free(array);
+}
+
+/**
+ * record_free - Frees a record of a list, unless it is in the array the
+ *				 list was packed into
+ * @node: void pointer to the record
+ * @idx: index of the node (unused)
+ * @arg: array holding the array, a pointer to its number of records, and a
+ *		 pointer to the size of a record
+ *
+ * Return: 0
+*/
+int record_free(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	uint8_t *array = ptr[0];
+	int32_t nb = *(int32_t *)ptr[1];
+	size_t size = *(size_t *)ptr[2];
+
+	if (!array || nb < 0 || (uint8_t *)node < array ||
+		(uint8_t *)node >= array + nb * size)
+		free(node);
+	return (0);
+	(void)idx;
 }
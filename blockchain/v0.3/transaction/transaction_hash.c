@@ -1,8 +1,8 @@
 #include "transaction.h"
 
 /* Utility functions define after transaction_hash function */
-int add_output_hashes_to_buf(llist_node_t node, unsigned int idx, void *arg);
-int add_input_hashes_to_buf(llist_node_t node, unsigned int idx, void *arg);
+int hash_output(llist_node_t node, unsigned int idx, void *arg);
+int hash_input(llist_node_t node, unsigned int idx, void *arg);
 
 /**
  * transaction_hash - computes the ID (hash) of a transaction
@@ -21,77 +21,56 @@ int add_input_hashes_to_buf(llist_node_t node, unsigned int idx, void *arg);
  *
  *		3.For example, the buffer for a transaction with 4 inputs and 2 outputs
  *		would be 448 bytes long (32 * 3 * 4 + 32 * 2)
+ *
+ * The fields are fed to the hash straight from the inputs and outputs, so
+ * the buffer is never built.
 */
 uint8_t *transaction_hash(transaction_t const *transaction,
 						  uint8_t hash_buf[SHA256_DIGEST_LENGTH])
 {
-	uint8_t *buf, *current_pos;
-	size_t buf_size;
-	size_t size_inputs, size_outputs;
+	sha256_ctx_t ctx;
 
 	if (!transaction || hash_buf == NULL)
 		return (NULL);
 
-	size_inputs = SHA256_DIGEST_LENGTH * (llist_size(transaction->inputs) * 3);
-	size_outputs = SHA256_DIGEST_LENGTH * llist_size(transaction->outputs);
-	buf_size = size_inputs + size_outputs;
-
-	buf = malloc(buf_size);
-	if (!buf)
-		return (NULL);
-
-	current_pos = buf;
-	llist_for_each(transaction->inputs, add_input_hashes_to_buf, &current_pos);
-	llist_for_each(transaction->outputs, add_output_hashes_to_buf, &current_pos);
-
-	sha256((int8_t const *)buf, buf_size, hash_buf);
+	sha256_init(&ctx);
+	tx_inputs_for_each(transaction, hash_input, &ctx);
+	tx_outputs_for_each(transaction, hash_output, &ctx);
 
-	free(buf);
-	return (hash_buf);
+	return (sha256_final(&ctx, hash_buf));
 }
 
 /**
- * add_input_hashes_to_buf - add_input_hashes_to_buf
+ * hash_input - feeds the fields of an input to the hash of its transaction
  * @node: tx_in_t input node
  * @idx: index of node
- * @arg: buffer to update
+ * @arg: SHA-256 context to update
  * Return: 0
 */
-int add_input_hashes_to_buf(llist_node_t node, unsigned int idx, void *arg)
+int hash_input(llist_node_t node, unsigned int idx, void *arg)
 {
 	/* block_hash, tx_id, tx_out_hash sizes are all 32 bytes*/
 	const size_t size_to_add = SHA256_DIGEST_LENGTH * 3;
-	uint8_t **buf_current_pos = (uint8_t **) arg;
-	tx_in_t *tx_in = (tx_in_t *) node;
 
 	idx = idx; /* to remove warning unused variable */
 
-	memcpy(*buf_current_pos, tx_in, size_to_add);
-
-	*buf_current_pos += size_to_add;
+	sha256_update(arg, node, size_to_add);
 	return (0);
 }
 
 /**
- * add_output_hashes_to_buf - add_output_hashes_to_buf
- * @node: tx_in_t input node
+ * hash_output - feeds the hash of an output to the hash of its transaction
+ * @node: tx_out_t output node
  * @idx: index of node
- * @arg: buffer to update
+ * @arg: SHA-256 context to update
  * Return: 0
 */
-int add_output_hashes_to_buf(llist_node_t node, unsigned int idx, void *arg)
+int hash_output(llist_node_t node, unsigned int idx, void *arg)
 {
-	/* hash size is 32 bytes */
-	const size_t size_to_add = SHA256_DIGEST_LENGTH;
-	uint8_t **buf_current_pos = (uint8_t **) arg;
 	tx_out_t *tx_out = (tx_out_t *) node;
-	uint8_t *tx_out_hash = tx_out->hash;
 
 	idx = idx; /* to remove warning unused variable */
 
-	memcpy(*buf_current_pos, tx_out_hash, size_to_add);
-
-	*buf_current_pos += size_to_add;
-
+	sha256_update(arg, tx_out->hash, SHA256_DIGEST_LENGTH);
 	return (0);
 }
@@ -1,5 +1,8 @@
 #include "transaction.h"
 
+int transaction_check(transaction_t const *transaction, llist_t *all_unspent,
+					  utxo_index_t const *index, sig_batch_t *batch,
+					  spent_set_t *spent);
 int verify_input(llist_node_t node, unsigned int idx, void *arg);
 int are_in_out_matching(llist_node_t node, void *arg);
 int add_amount(llist_node_t node, unsigned int idx, void *arg);
@@ -18,18 +21,48 @@ int add_amount(llist_node_t node, unsigned int idx, void *arg);
  *	 in all_unspent
  *
  *	*Each input’s signature must be verified using the public key stored in
- *	 the referenced unspent output
+ *	 the referenced unspent output. An input with an empty signature is
+ *	 covered by the signature of an earlier input spending an output of the
+ *	 same key (TX_VERSION_PER_KEY), so each key is verified once. The
+ *	 keys already verified are only recorded for such transactions
  *
  *	*The total amount of inputs must match the total amount of outputs
 */
 int transaction_is_valid(transaction_t const *transaction,
 						 llist_t *all_unspent)
+{
+	if (!all_unspent)
+		return (0);
+
+	return (transaction_check(transaction, all_unspent, NULL, NULL, NULL));
+}
+
+/**
+ * transaction_check - checks whether a transaction is valid, looking up the
+ *					   referenced outputs in an index if given, or in a list
+ * @transaction: points to the transaction to verify
+ * @all_unspent: is the list of all unspent transaction outputs to date
+ * @index: is the hash index of all unspent transaction outputs, or NULL
+ *		   to scan all_unspent
+ * @batch: if not NULL, the input signatures are added to it instead of
+ *		   being verified
+ * @spent: if not NULL, set of the outputs already spent in the same Block,
+ *		   the outputs spent by transaction are added to it, and the
+ *		   transaction is invalid if one of them was already there
+ *
+ * Return: 1 if the transaction is valid, 0 otherwise
+*/
+int transaction_check(transaction_t const *transaction, llist_t *all_unspent,
+					  utxo_index_t const *index, sig_batch_t *batch,
+					  spent_set_t *spent)
 {
 	uint8_t hash_buf[SHA256_DIGEST_LENGTH];
-	void *args[3] = {0};
+	void *args[7] = {0};
 	uint32_t inputs_amount = 0, outputs_amount = 0;
+	tx_signers_t signers = {NULL, 0, 0};
+	int ret;
 
-	if (!transaction || !all_unspent)
+	if (!transaction)
 		return (0);
 
 	/* Check transaction hash */
@@ -39,12 +72,17 @@ int transaction_is_valid(transaction_t const *transaction,
 
 	/* Check transaction inputs */
 	args[0] = all_unspent, args[1] = (transaction_t *) transaction->id;
-	args[2] = &inputs_amount;
-
-	if (llist_for_each(transaction->inputs, verify_input, args) == -1)
+	args[2] = &inputs_amount, args[3] = (utxo_index_t *) index;
+	args[4] = batch, args[5] = spent;
+	if (transaction_version(transaction) == TX_VERSION_PER_KEY)
+		args[6] = &signers;
+
+	ret = tx_inputs_for_each(transaction, verify_input, args);
+	tx_signers_clear(&signers);
+	if (ret == -1)
 		return (0);
 
-	llist_for_each(transaction->outputs, add_amount, &outputs_amount);
+	tx_outputs_for_each(transaction, add_amount, &outputs_amount);
 
 	/* Check that amounts are matching in inputs and outputs */
 	if (inputs_amount != outputs_amount)
@@ -58,7 +96,12 @@ int transaction_is_valid(transaction_t const *transaction,
  * @node: void pointer of transaction input tx_in
  * @idx: index of the node (unused)
  * @arg: array of void * args containing the list of all utxos(all_unspent),
- *		 the transaction id (hash) and the amount from inputs (to update)
+ *		 the transaction id (hash), the amount from inputs (to update)
+ *		 the index of all utxos (NULL to scan the list)
+ *		 the batch collecting the signatures (NULL to verify them),
+ *		 the set of outputs spent in the Block (NULL if none)
+ *		 and the keys whose signature was already checked (NULL if
+ *		 every input holds its own signature)
  *
  * Return: 0 if success, -1 on failure
 */
@@ -69,15 +112,42 @@ int verify_input(llist_node_t node, unsigned int idx, void *arg)
 	llist_t *all_unspent = (llist_t *) ptr[0];
 	uint8_t *transaction_id = (uint8_t *) ptr[1];
 	uint32_t *inputs_amount = ptr[2];
+	utxo_index_t *index = ptr[3];
+	sig_batch_t *batch = ptr[4];
 	utxo_t *ref_utxo;
 	EC_KEY *ref_utxo_key;
 
-	ref_utxo = llist_find_node(all_unspent, are_in_out_matching,
-							   tx_in);
+	if (index)
+		ref_utxo = utxo_index_find(index, tx_in);
+	else
+		ref_utxo = llist_find_node(all_unspent, are_in_out_matching,
+								   tx_in);
 	if (!ref_utxo)
 		return (-1); /* Input's reference to utxo not present in all_unspent */
 
-	ref_utxo_key = ec_from_pub(ref_utxo->out.pub);
+	/* Output already spent by another input of the Block */
+	if (ptr[5] && spent_set_add(ptr[5], tx_in, ref_utxo) != 1)
+		return (-1);
+
+	/* Signed once for all the inputs of the same key */
+	if (!tx_in->sig.len)
+	{
+		if (!tx_signers_find(ptr[6], ref_utxo->out.pub))
+			return (-1);
+		*inputs_amount += ref_utxo->out.amount;
+		return (0);
+	}
+
+	if (batch)
+	{
+		*inputs_amount += ref_utxo->out.amount;
+		if (sig_batch_add(batch, ref_utxo->out.pub, transaction_id,
+						  &(tx_in->sig)) == -1)
+			return (-1);
+		return (ptr[6] ? tx_signers_add(ptr[6], ref_utxo->out.pub) : 0);
+	}
+
+	ref_utxo_key = ec_from_pub_cached(ref_utxo->out.pub);
 	if (!ref_utxo_key)
 	{
 		EC_KEY_free(ref_utxo_key);
@@ -94,7 +164,7 @@ int verify_input(llist_node_t node, unsigned int idx, void *arg)
 
 	idx = idx;
 	EC_KEY_free(ref_utxo_key);
-	return (0);
+	return (ptr[6] ? tx_signers_add(ptr[6], ref_utxo->out.pub) : 0);
 }
 
 /**
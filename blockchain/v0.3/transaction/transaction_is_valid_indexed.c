@@ -0,0 +1,48 @@
+#include "transaction.h"
+
+/* Defined in transaction_is_valid.c */
+int transaction_check(transaction_t const *transaction, llist_t *all_unspent,
+					  utxo_index_t const *index, sig_batch_t *batch,
+					  spent_set_t *spent);
+
+/**
+ * transaction_is_valid_indexed - checks whether a transaction is valid,
+ *								  using a hash index of the unspent outputs
+ * @transaction: points to the transaction to verify
+ * @index: is the hash index of all unspent transaction outputs to date
+ *
+ * Description: Same checks as transaction_is_valid(), but the output
+ * referenced by each input is found in constant time.
+ *
+ * Return: 1 if the transaction is valid, 0 otherwise
+*/
+int transaction_is_valid_indexed(transaction_t const *transaction,
+								 utxo_index_t const *index)
+{
+	if (!index)
+		return (0);
+
+	return (transaction_check(transaction, NULL, index, NULL, NULL));
+}
+
+/**
+ * transaction_is_valid_deferred - checks whether a transaction is valid,
+ *								   except for its input signatures
+ * @transaction: points to the transaction to verify
+ * @index: is the hash index of all unspent transaction outputs to date
+ * @batch: collects the input signatures, along with the public key
+ *		   they must be verified with, so they can be verified later
+ *		   (e.g. with ec_verify_parallel)
+ *
+ * Return: 1 if the transaction is valid, provided its signatures are,
+ *		   0 otherwise
+*/
+int transaction_is_valid_deferred(transaction_t const *transaction,
+								  utxo_index_t const *index,
+								  sig_batch_t *batch)
+{
+	if (!index || !batch)
+		return (0);
+
+	return (transaction_check(transaction, NULL, index, batch, NULL));
+}
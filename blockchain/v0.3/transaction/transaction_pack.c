@@ -0,0 +1,160 @@
+#include "transaction.h"
+
+/* Defined after */
+int pack_records(llist_t **list, size_t size, arena_t *arena, void **array);
+int copy_record(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * transaction_pack - Moves the inputs and outputs of a transaction into
+ *					  contiguous arrays
+ * @transaction: Pointer to the transaction
+ *
+ * Description: The arrays are allocated from the arena of the transaction
+ * if it has one, and each list is rebuilt to point into its array, so the
+ * lists can still be read as before. Inputs pointing into a mapped file
+ * are copied out of it. Lists already packed are left untouched. Packed
+ * records must not be freed one by one, so the transactions built on the
+ * heap by transaction_create() are not packed by the library.
+ *
+ * Return: 0 on success, -1 on failure, the transaction being untouched
+*/
+int transaction_pack(transaction_t *transaction)
+{
+	transaction_t *tx = transaction;
+	llist_t *old;
+	void *array;
+
+	if (!tx)
+		return (-1);
+
+	if (tx->inputs && (tx->mapped || !TX_INPUTS_PACKED(tx)))
+	{
+		old = tx->inputs;
+		if (pack_records(&tx->inputs, sizeof(tx_in_t), tx->arena,
+						 &array) == -1)
+			return (-1);
+		records_destroy(old, tx->input_array, tx->nb_inputs,
+						sizeof(tx_in_t), !tx->arena && !tx->mapped);
+		tx->input_array = array;
+		tx->nb_inputs = llist_size(tx->inputs);
+		tx->mapped = 0;
+	}
+
+	if (tx->outputs && !TX_OUTPUTS_PACKED(tx))
+	{
+		old = tx->outputs;
+		if (pack_records(&tx->outputs, sizeof(tx_out_t), tx->arena,
+						 &array) == -1)
+			return (-1);
+		records_destroy(old, tx->output_array, tx->nb_outputs,
+						sizeof(tx_out_t), !tx->arena);
+		tx->output_array = array;
+		tx->nb_outputs = llist_size(tx->outputs);
+	}
+
+	return (0);
+}
+
+/**
+ * pack_records - Copies the fixed-size records of a list into an array,
+ *				  and replaces the list by one pointing into the array
+ * @list: Pointer to the list, the old list is left to the caller
+ * @size: Size of each record
+ * @arena: Arena to allocate the array from, or NULL to use the heap
+ * @array: Pointer receiving the array, NULL if the list is empty
+ *
+ * Return: 0 on success, -1 on failure, the list being untouched
+*/
+int pack_records(llist_t **list, size_t size, arena_t *arena, void **array)
+{
+	int nb = llist_size(*list), i, ok;
+	llist_t *packed = llist_create(MT_SUPPORT_FALSE);
+	void *arg[2];
+
+	*array = nb > 0 ? arena_alloc(arena, nb * size) : NULL;
+	arg[0] = *array, arg[1] = &size;
+	ok = packed && nb >= 0 && (nb == 0 || *array) &&
+		 llist_for_each(*list, copy_record, arg) != -1;
+	for (i = 0; ok && i < nb; i++)
+		ok = llist_add_node(packed, (uint8_t *)*array + i * size,
+							ADD_NODE_REAR) != -1;
+	if (!ok)
+	{
+		if (packed)
+			llist_destroy(packed, 0, NULL);
+		arena_free(arena, *array);
+		return (-1);
+	}
+
+	*list = packed;
+	return (0);
+}
+
+/**
+ * copy_record - Copies a record into its slot of an array
+ * @node: void pointer to the record
+ * @idx: index of the node, also its position in the array
+ * @arg: array holding the array, and a pointer to the size of a record
+ *
+ * Return: 0
+*/
+int copy_record(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	size_t size = *(size_t *)ptr[1];
+
+	memcpy((uint8_t *)ptr[0] + idx * size, node, size);
+	return (0);
+}
+
+/**
+ * tx_inputs_for_each - Calls a function for each input of a transaction,
+ *						in order, like llist_for_each()
+ * @transaction: Pointer to the transaction
+ * @func: Function called with each tx_in_t, its index and arg
+ * @arg: Argument passed to func
+ *
+ * Description: Packed inputs are read straight from their array.
+ *
+ * Return: 0 on success, -1 if func returned non-zero or on failure
+*/
+int tx_inputs_for_each(transaction_t const *transaction, node_func_t func,
+					   void *arg)
+{
+	int32_t i;
+
+	if (!TX_INPUTS_PACKED(transaction))
+		return (llist_for_each(transaction->inputs, func, arg));
+
+	for (i = 0; i < transaction->nb_inputs; i++)
+		if (func(&transaction->input_array[i], i, arg))
+			return (-1);
+
+	return (0);
+}
+
+/**
+ * tx_outputs_for_each - Calls a function for each output of a transaction,
+ *						 in order, like llist_for_each()
+ * @transaction: Pointer to the transaction
+ * @func: Function called with each tx_out_t, its index and arg
+ * @arg: Argument passed to func
+ *
+ * Description: Packed outputs are read straight from their array.
+ *
+ * Return: 0 on success, -1 if func returned non-zero or on failure
+*/
+int tx_outputs_for_each(transaction_t const *transaction, node_func_t func,
+						void *arg)
+{
+	int32_t i;
+
+	if (!TX_OUTPUTS_PACKED(transaction))
+		return (llist_for_each(transaction->outputs, func, arg));
+
+	for (i = 0; i < transaction->nb_outputs; i++)
+		if (func(&transaction->output_array[i], i, arg))
+			return (-1);
+
+	return (0);
+}
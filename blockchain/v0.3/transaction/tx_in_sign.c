@@ -3,6 +3,8 @@
 /* Utility function used to find the corresponding tx_out struct */
 /* Defined at the end */
 int cmp_tx_out_hash(llist_node_t utxo, void *tx_out_hash);
+sig_t *tx_in_sign_utxo(tx_in_t *in, uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+					   EC_KEY const *sender, utxo_t const *utxo);
 
 /**
  * tx_in_sign - signs a transaction input, given the transaction id it is from.
@@ -28,20 +30,64 @@ int cmp_tx_out_hash(llist_node_t utxo, void *tx_out_hash);
 sig_t *tx_in_sign(tx_in_t *in, uint8_t const tx_id[SHA256_DIGEST_LENGTH],
 				  EC_KEY const *sender, llist_t *all_unspent)
 {
-	uint8_t pub[EC_PUB_LEN];
 	utxo_t *utxo;
 
 	if (!in || tx_id == NULL || !sender || !all_unspent)
 		return (NULL);
 
-	/* Get public key fron EC_KEY struct of sender */
-	if (!ec_to_pub(sender, pub))
-		return (NULL);
-
 	/* Find node with the corresponding tx_out_hash refefrenced by tx_in in */
 	utxo = (utxo_t *) llist_find_node(all_unspent, cmp_tx_out_hash,
 									  in->tx_out_hash);
 
+	return (tx_in_sign_utxo(in, tx_id, sender, utxo));
+}
+
+/**
+ * tx_in_sign_indexed - signs a transaction input, given the transaction id
+ *						it is from, using a hash index of the unspent outputs
+ * @in: points to the transaction input structure to sign.
+ * @tx_id: contains the ID (hash) of the transaction the transaction
+ *		   input to sign is stored in.
+ * @sender: contains the private key of the receiver of the coins contained
+ *			in the transaction output referenced by the transaction input.
+ * @index: hash index of all unspent transaction outputs to date.
+ *
+ * Return: pointer to the resulting signature structure upon success,
+ *		   or NULL upon failure.
+ */
+sig_t *tx_in_sign_indexed(tx_in_t *in, uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+						  EC_KEY const *sender, utxo_index_t const *index)
+{
+	if (!in || tx_id == NULL || !sender || !index)
+		return (NULL);
+
+	return (tx_in_sign_utxo(in, tx_id, sender, utxo_index_find(index, in)));
+}
+
+/**
+ * tx_in_sign_utxo - signs a transaction input, given the output it spends
+ * @in: points to the transaction input structure to sign.
+ * @tx_id: contains the ID (hash) of the transaction the transaction
+ *		   input to sign is stored in.
+ * @sender: contains the private key of the receiver of the coins contained
+ *			in utxo.
+ * @utxo: unspent output referenced by in, or NULL if it was not found
+ *
+ * Return: pointer to the resulting signature structure upon success,
+ *		   or NULL upon failure.
+ */
+sig_t *tx_in_sign_utxo(tx_in_t *in, uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+					   EC_KEY const *sender, utxo_t const *utxo)
+{
+	uint8_t pub[EC_PUB_LEN];
+
+	if (!utxo)
+		return (NULL);
+
+	/* Get public key fron EC_KEY struct of sender */
+	if (!ec_to_pub(sender, pub))
+		return (NULL);
+
 	/* Verify that public keys are matching  */
 	if (memcmp(pub, utxo->out.pub, EC_PUB_LEN) != 0)
 		return (NULL);
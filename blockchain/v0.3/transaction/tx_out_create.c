@@ -9,6 +9,22 @@
  * or NULL on failure
 */
 tx_out_t *tx_out_create(uint32_t amount, uint8_t const pub[EC_PUB_LEN])
+{
+	return (tx_out_create_in(NULL, amount, pub));
+}
+
+/**
+ * tx_out_create_in - allocates a transaction output structure from an arena
+ *					  and initializes it
+ * @arena: arena to allocate the output from, or NULL to use the heap
+ * @amount: amount of the transaction
+ * @pub: public key of the transaction receiver
+ *
+ * Return: Pointer to the created transaction output upon success,
+ * or NULL on failure
+*/
+tx_out_t *tx_out_create_in(arena_t *arena, uint32_t amount,
+						   uint8_t const pub[EC_PUB_LEN])
 {
 	size_t len;
 	tx_out_t *new_tx_out;
@@ -16,12 +32,10 @@ tx_out_t *tx_out_create(uint32_t amount, uint8_t const pub[EC_PUB_LEN])
 	if (pub == NULL)
 		return (NULL);
 
-	new_tx_out = malloc(sizeof(tx_out_t));
+	/* Members are initialized to 0 */
+	new_tx_out = arena_alloc(arena, sizeof(tx_out_t));
 	if (!new_tx_out)
 		return (NULL);
-
-	/* Init members to 0*/
-	memset(new_tx_out, 0, sizeof(*new_tx_out));
 	/* Update values */
 	new_tx_out->amount = amount;
 	memcpy(new_tx_out->pub, pub, sizeof(new_tx_out->pub));
@@ -30,7 +44,7 @@ tx_out_t *tx_out_create(uint32_t amount, uint8_t const pub[EC_PUB_LEN])
 
 	if (!sha256((int8_t const *)new_tx_out, len, new_tx_out->hash))
 	{
-		free(new_tx_out);
+		arena_free(arena, new_tx_out);
 		return (NULL);
 	}
 
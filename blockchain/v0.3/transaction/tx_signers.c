@@ -0,0 +1,103 @@
+#include "transaction.h"
+
+/* Defined after */
+int has_empty_sig(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * transaction_version - Tells how the inputs of a transaction are signed
+ * @transaction: Pointer to the transaction, not a coinbase transaction
+ *
+ * Return: TX_VERSION_PER_KEY if one of its inputs has an empty signature,
+ *		   TX_VERSION_PER_INPUT otherwise
+*/
+uint8_t transaction_version(transaction_t const *transaction)
+{
+	if (transaction &&
+		tx_inputs_for_each(transaction, has_empty_sig, NULL) == -1)
+		return (TX_VERSION_PER_KEY);
+
+	return (TX_VERSION_PER_INPUT);
+}
+
+/**
+ * has_empty_sig - Stops the iteration at an input with an empty signature
+ * @node: void pointer to the tx_in_t
+ * @idx: index of the node (unused)
+ * @arg: unused
+ *
+ * Return: -1 if the signature of the input is empty, 0 otherwise
+*/
+int has_empty_sig(llist_node_t node, unsigned int idx, void *arg)
+{
+	return (((tx_in_t *) node)->sig.len ? 0 : -1);
+	(void)idx;
+	(void)arg;
+}
+
+/**
+ * tx_signers_find - Tells whether the signature of a public key was checked
+ * @signers: Pointer to the keys checked so far
+ * @pub: Public key to look for
+ *
+ * Description: A transaction usually has a single signer, so the keys are
+ * searched linearly.
+ *
+ * Return: 1 if pub is in signers, 0 otherwise
+*/
+int tx_signers_find(tx_signers_t const *signers,
+					uint8_t const pub[EC_PUB_LEN])
+{
+	size_t i;
+
+	for (i = 0; signers && i < signers->size; i++)
+	{
+		if (!memcmp(signers->pubs[i], pub, EC_PUB_LEN))
+			return (1);
+	}
+
+	return (0);
+}
+
+/**
+ * tx_signers_add - Records a public key whose signature was checked
+ * @signers: Pointer to the keys checked so far
+ * @pub: Public key to add, must outlive signers
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int tx_signers_add(tx_signers_t *signers, uint8_t const pub[EC_PUB_LEN])
+{
+	uint8_t const **pubs;
+
+	if (!signers || !pub)
+		return (-1);
+
+	if (tx_signers_find(signers, pub))
+		return (0);
+
+	if (signers->size == signers->capacity)
+	{
+		pubs = realloc((void *) signers->pubs, (signers->capacity * 2 + 4) *
+					   sizeof(*pubs));
+		if (!pubs)
+			return (-1);
+		signers->pubs = pubs, signers->capacity = signers->capacity * 2 + 4;
+	}
+
+	signers->pubs[signers->size++] = pub;
+	return (0);
+}
+
+/**
+ * tx_signers_clear - Frees the keys recorded in a set of signers
+ * @signers: Pointer to the keys to clear, can be reused afterwards
+*/
+void tx_signers_clear(tx_signers_t *signers)
+{
+	if (!signers)
+		return;
+
+	free((void *) signers->pubs);
+	signers->pubs = NULL;
+	signers->size = 0, signers->capacity = 0;
+}
@@ -0,0 +1,111 @@
+#include "transaction.h"
+
+/* Defined after */
+int index_ins_outs(llist_node_t node, unsigned int idx, void *arg);
+int unindex_input(llist_node_t node, unsigned int idx, void *arg);
+int index_output(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * update_unspent_indexed - Updates the list of all unspent transaction
+ *							outputs and its index, given a list of
+ *							processed transactions.
+ * @transactions: List of validated transactions
+ * @block_hash: Hash of the validated Block that contains the transaction list
+ * @all_unspent: is the current list of unspent transaction outputs
+ * @index: Hash index of all_unspent, kept in sync
+ *
+ * Description: Same as update_unspent(), but each spent output is found
+ * in constant time through the index, instead of scanning all_unspent for
+ * each input, and removed in constant time (see utxo_index_unlist), so the
+ * order of all_unspent is not kept.
+ *
+ * Return: all_unspent, updated, or NULL on failure
+*/
+llist_t *update_unspent_indexed(llist_t *transactions,
+								uint8_t block_hash[SHA256_DIGEST_LENGTH],
+								llist_t *all_unspent, utxo_index_t *index)
+{
+	void *arg[4] = {0};
+
+	if (!transactions || (block_hash == NULL) || !all_unspent || !index)
+		return (NULL);
+
+	arg[0] = index, arg[1] = all_unspent, arg[2] = block_hash;
+	if (llist_for_each(transactions, index_ins_outs, arg) == -1)
+		return (NULL);
+
+	return (all_unspent);
+}
+
+/**
+ * index_ins_outs - Unindexes the outputs spent by a transaction,
+ *					then lists and indexes the outputs it creates
+ * @node: void pointer to current transaction
+ * @idx: idx of the node (unused)
+ * @arg: array holding the index, the list of unspent,
+ *		 the Block hash and the current transaction id
+ *
+ * Return: 0 if success, -1 on failure
+*/
+int index_ins_outs(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t *tx = (transaction_t *) node;
+	void **ptr = arg;
+
+	tx_inputs_for_each(tx, unindex_input, ptr);
+
+	ptr[3] = tx->id; /* Used for unspent_tx_out_create */
+	if (tx_outputs_for_each(tx, index_output, ptr) == -1)
+		return (-1);
+
+	return (0);
+	(void)idx;
+}
+
+/**
+ * unindex_input - Removes from the index and the list of unspent the output
+ *				   referenced by an input, and frees it
+ * @node: void pointer to current tx_in
+ * @idx: idx of the node (unused)
+ * @arg: array holding the index and the list of unspent
+ *
+ * Return: 0
+*/
+int unindex_input(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	utxo_t *utxo = utxo_index_remove(ptr[0], (tx_in_t *) node);
+
+	if (utxo)
+		utxo_index_unlist(ptr[0], ptr[1], utxo);
+
+	return (0);
+	(void)idx;
+}
+
+/**
+ * index_output - Appends an output to the list of unspent and indexes it
+ * @node: void pointer to current tx_out output
+ * @idx: idx of the node (unused)
+ * @arg: array holding the index, the list of unspent,
+ *		 the Block hash and the current transaction id
+ *
+ * Return: 0 if success, -1 on failure
+*/
+int index_output(llist_node_t node, unsigned int idx, void *arg)
+{
+	void **ptr = arg;
+	utxo_t *utxo = unspent_tx_out_create(ptr[2], ptr[3], (tx_out_t *) node);
+
+	if (!utxo)
+		return (-1);
+
+	if (llist_add_node(ptr[1], utxo, ADD_NODE_REAR) == -1)
+	{
+		free(utxo);
+		return (-1);
+	}
+
+	return (utxo_index_add(ptr[0], utxo));
+	(void)idx;
+}
@@ -0,0 +1,98 @@
+#include "transaction.h"
+
+/**
+ * utxo_index_address - Finds the unspent outputs owned by an address
+ * @index: Pointer to the index to search
+ * @pub: Public key of the address
+ *
+ * Return: Pointer to the address, or NULL if no output was ever sent to it
+*/
+utxo_address_t *utxo_index_address(utxo_index_t const *index,
+								   uint8_t const pub[EC_PUB_LEN])
+{
+	utxo_address_t **slot;
+
+	if (!index || !pub)
+		return (NULL);
+
+	slot = probe_get(&index->addresses, &utxo_address_ops,
+					 utxo_pub_hash(pub), utxo_address_is, pub);
+	return (slot ? *slot : NULL);
+}
+
+/**
+ * utxo_address_add - Adds an unspent output to the outputs of its address
+ * @index: Pointer to the index to update
+ * @utxo: Unspent output to add
+ * @pos: Receives the position of utxo in the outputs of its address
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int utxo_address_add(utxo_index_t *index, utxo_t *utxo, size_t *pos)
+{
+	utxo_address_t *address, **slot;
+	utxo_t **utxos;
+	size_t i;
+
+	if (probe_reserve(&index->addresses, &utxo_address_ops, 1) == -1)
+		return (-1);
+
+	i = probe_find(&index->addresses, &utxo_address_ops,
+				   utxo_pub_hash(utxo->out.pub), utxo_address_is,
+				   utxo->out.pub);
+	slot = probe_at(&index->addresses, &utxo_address_ops, i);
+	address = *slot;
+	if (!address)
+	{
+		address = calloc(1, sizeof(*address));
+		if (!address)
+			return (-1);
+		memcpy(address->pub, utxo->out.pub, EC_PUB_LEN);
+		slot = probe_claim(&index->addresses, &utxo_address_ops, i);
+		*slot = address;
+	}
+
+	if (address->size == address->capacity)
+	{
+		utxos = realloc(address->utxos, (address->capacity * 2 + 4) *
+						sizeof(*utxos));
+		if (!utxos)
+			return (-1);
+		address->utxos = utxos, address->capacity = address->capacity * 2 + 4;
+	}
+
+	*pos = address->size;
+	address->utxos[address->size++] = utxo;
+	address->balance += utxo->out.amount;
+	return (0);
+}
+
+/**
+ * utxo_address_remove - Removes an unspent output from the outputs
+ *						 of its address
+ * @index: Pointer to the index to update
+ * @utxo: Unspent output to remove
+ * @pos: Position of utxo in the outputs of its address
+ *
+ * Description: The last output of the address takes the place of utxo,
+ * and its new position is stored in its slot of the index.
+*/
+void utxo_address_remove(utxo_index_t *index, utxo_t const *utxo, size_t pos)
+{
+	utxo_address_t *address = utxo_index_address(index, utxo->out.pub);
+	utxo_slot_t *slot;
+	utxo_t *last;
+
+	if (!address || pos >= address->size || address->utxos[pos] != utxo)
+		return;
+
+	last = address->utxos[--address->size];
+	address->balance -= utxo->out.amount;
+	if (last == utxo)
+		return;
+
+	address->utxos[pos] = last;
+	slot = probe_at(&index->outputs, &utxo_index_ops,
+					utxo_index_slot(index, last));
+	slot->pos = pos;
+}
@@ -0,0 +1,84 @@
+#include "transaction.h"
+
+/* Defined after */
+int utxo_address_state(void const *slot);
+size_t utxo_address_hash(void const *slot);
+
+probe_ops_t const utxo_address_ops = {
+	sizeof(utxo_address_t *), utxo_address_state, utxo_address_hash, NULL
+};
+
+/**
+ * utxo_address_state - Tells whether a slot of the addresses of an index
+ *						is used
+ * @slot: void pointer to the utxo_address_t pointer of the slot
+ *
+ * Return: PROBE_EMPTY or PROBE_USED, an address is never removed
+*/
+int utxo_address_state(void const *slot)
+{
+	return (*(utxo_address_t * const *) slot ? PROBE_USED : PROBE_EMPTY);
+}
+
+/**
+ * utxo_address_hash - Computes the hash table key of the address of a slot
+ * @slot: void pointer to the used utxo_address_t pointer
+ *
+ * Return: Hash table key, see utxo_pub_hash()
+*/
+size_t utxo_address_hash(void const *slot)
+{
+	return (utxo_pub_hash((*(utxo_address_t * const *) slot)->pub));
+}
+
+/**
+ * utxo_pub_hash - Computes the hash table key of a public key
+ * @pub: Public key of the address
+ *
+ * Return: Hash table key
+*/
+size_t utxo_pub_hash(uint8_t const pub[EC_PUB_LEN])
+{
+	size_t hash;
+
+	/* Skip the leading 0x04 of the uncompressed point, the rest is random */
+	memcpy(&hash, pub + 1, sizeof(hash));
+	return (hash);
+}
+
+/**
+ * utxo_address_is - Checks whether the address of a slot has a given
+ *					 public key
+ * @slot: void pointer to the used utxo_address_t pointer
+ * @key: Public key to look for, EC_PUB_LEN bytes long
+ *
+ * Return: 1 if the address has this public key, 0 otherwise
+*/
+int utxo_address_is(void const *slot, void const *key)
+{
+	return (!memcmp((*(utxo_address_t * const *) slot)->pub, key,
+					EC_PUB_LEN));
+}
+
+/**
+ * utxo_address_destroy_all - Deletes the addresses of an index,
+ *							  the unspent outputs are untouched
+ * @index: Pointer to the index to update
+*/
+void utxo_address_destroy_all(utxo_index_t *index)
+{
+	utxo_address_t **slot;
+	size_t i;
+
+	for (i = 0; i < index->addresses.capacity; i++)
+	{
+		slot = probe_at(&index->addresses, &utxo_address_ops, i);
+		if (*slot)
+		{
+			free((*slot)->utxos);
+			free(*slot);
+		}
+	}
+
+	probe_clear(&index->addresses);
+}
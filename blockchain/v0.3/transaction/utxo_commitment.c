@@ -0,0 +1,109 @@
+#include "transaction.h"
+
+/* Defined after */
+int collect_utxo(llist_node_t node, unsigned int idx, void *arg);
+int utxo_compare(void const *a, void const *b);
+void utxo_commit(sha256_ctx_t *ctx, utxo_t const *utxo);
+
+/**
+ * utxo_commitment - Computes the commitment of a set of unspent outputs
+ * @all_unspent: List of unspent outputs
+ * @hash_buf: Buffer receiving the commitment
+ *
+ * Description: The outputs are sorted by output hash, then by transaction
+ * ID and Block hash, so the commitment does not depend on the order of the
+ * list. Each output is then hashed in turn, in a single SHA-256: Block
+ * hash, transaction ID, amount (4 bytes, little endian), public key and
+ * output hash.
+ *
+ * Return: hash_buf upon success, or NULL upon failure
+*/
+uint8_t *utxo_commitment(llist_t *all_unspent,
+						 uint8_t hash_buf[SHA256_DIGEST_LENGTH])
+{
+	utxo_t **sorted = NULL;
+	sha256_ctx_t ctx;
+	int nb, i;
+
+	nb = llist_size(all_unspent);
+	if (nb == -1 || !hash_buf)
+		return (NULL);
+
+	if (nb > 0)
+	{
+		sorted = malloc(nb * sizeof(*sorted));
+		if (!sorted ||
+			llist_for_each(all_unspent, collect_utxo, sorted) == -1)
+		{
+			free(sorted);
+			return (NULL);
+		}
+		qsort(sorted, nb, sizeof(*sorted), utxo_compare);
+	}
+
+	sha256_init(&ctx);
+	for (i = 0; i < nb; i++)
+		utxo_commit(&ctx, sorted[i]);
+	sha256_final(&ctx, hash_buf);
+
+	free(sorted);
+	return (hash_buf);
+}
+
+/**
+ * collect_utxo - Stores an unspent output in an array
+ * @node: void pointer to the utxo_t
+ * @idx: index of the node, also its position in the array
+ * @arg: void pointer to the array of utxo_t pointers
+ *
+ * Return: 0
+*/
+int collect_utxo(llist_node_t node, unsigned int idx, void *arg)
+{
+	((utxo_t **)arg)[idx] = node;
+	return (0);
+}
+
+/**
+ * utxo_compare - qsort comparator, orders unspent outputs by output hash,
+ *				  then by transaction ID and Block hash
+ * @a: pointer to a pointer to the first utxo_t
+ * @b: pointer to a pointer to the second utxo_t
+ *
+ * Return: negative, 0 or positive, like memcmp()
+*/
+int utxo_compare(void const *a, void const *b)
+{
+	utxo_t const *u1 = *(utxo_t * const *)a;
+	utxo_t const *u2 = *(utxo_t * const *)b;
+	int cmp;
+
+	cmp = memcmp(u1->out.hash, u2->out.hash, SHA256_DIGEST_LENGTH);
+	if (cmp == 0)
+		cmp = memcmp(u1->tx_id, u2->tx_id, SHA256_DIGEST_LENGTH);
+	if (cmp == 0)
+		cmp = memcmp(u1->block_hash, u2->block_hash, SHA256_DIGEST_LENGTH);
+
+	return (cmp);
+}
+
+/**
+ * utxo_commit - Feeds an unspent output to a commitment being computed
+ * @ctx: SHA-256 context of the commitment
+ * @utxo: Unspent output
+*/
+void utxo_commit(sha256_ctx_t *ctx, utxo_t const *utxo)
+{
+	uint8_t amount[4];
+
+	amount[0] = utxo->out.amount & 0xff;
+	amount[1] = (utxo->out.amount >> 8) & 0xff;
+	amount[2] = (utxo->out.amount >> 16) & 0xff;
+	amount[3] = (utxo->out.amount >> 24) & 0xff;
+
+	sha256_update(ctx, utxo->block_hash, SHA256_DIGEST_LENGTH);
+	sha256_update(ctx, utxo->tx_id, SHA256_DIGEST_LENGTH);
+	sha256_update(ctx, amount, sizeof(amount));
+	sha256_update(ctx, utxo->out.pub, EC_PUB_LEN);
+	sha256_update(ctx, utxo->out.hash, SHA256_DIGEST_LENGTH);
+}
@@ -0,0 +1,95 @@
+#include "transaction.h"
+
+/* Defined after */
+int index_utxo(llist_node_t node, unsigned int idx, void *arg);
+
+/* Address used to mark the slots of removed unspent outputs */
+utxo_t utxo_index_tombstone;
+
+/**
+ * utxo_index_create - Builds a hash index over a list of unspent outputs
+ * @all_unspent: List of unspent transaction outputs to index, may be NULL
+ *				 to start with an empty index
+ *
+ * Return: Pointer to the created index, or NULL on failure
+*/
+utxo_index_t *utxo_index_create(llist_t *all_unspent)
+{
+	utxo_index_t *index = calloc(1, sizeof(*index));
+	int size = all_unspent ? llist_size(all_unspent) : 0;
+
+	if (!index)
+		return (NULL);
+
+	if (probe_reserve(&index->outputs, &utxo_index_ops,
+					  size > 0 ? (size_t)size : 0) == -1 ||
+		(all_unspent && llist_for_each(all_unspent, index_utxo, index) == -1))
+	{
+		utxo_index_destroy(index);
+		return (NULL);
+	}
+
+	return (index);
+}
+
+/**
+ * utxo_index_destroy - Deletes an index, the indexed outputs are untouched
+ * @index: Pointer to the index to delete
+*/
+void utxo_index_destroy(utxo_index_t *index)
+{
+	if (!index)
+		return;
+
+	utxo_address_destroy_all(index);
+	probe_clear(&index->outputs);
+	free(index);
+}
+
+/**
+ * utxo_index_add - Adds an unspent output to an index
+ * @index: Pointer to the index to update
+ * @utxo: Unspent output to add, its storage is not taken over by the index
+ *
+ * Description: The output is also added to the outputs of its address.
+ * An output already indexed is left as is.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int utxo_index_add(utxo_index_t *index, utxo_t *utxo)
+{
+	utxo_slot_t *slot;
+	size_t i, pos;
+
+	if (!index || !utxo)
+		return (-1);
+
+	if (probe_reserve(&index->outputs, &utxo_index_ops, 1) == -1)
+		return (-1);
+	i = probe_find(&index->outputs, &utxo_index_ops,
+				   utxo_index_hash(utxo->tx_id, utxo->out.hash),
+				   utxo_slot_holds, utxo);
+	slot = probe_at(&index->outputs, &utxo_index_ops, i);
+	if (utxo_index_ops.state(slot) == PROBE_USED)
+		return (0);
+	if (utxo_address_add(index, utxo, &pos) == -1)
+		return (-1);
+
+	slot = probe_claim(&index->outputs, &utxo_index_ops, i);
+	slot->utxo = utxo, slot->pos = pos;
+	return (0);
+}
+
+/**
+ * index_utxo - Adds an unspent output of a list to an index
+ * @node: void pointer to the utxo_t to index
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the utxo_index_t to update
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int index_utxo(llist_node_t node, unsigned int idx, void *arg)
+{
+	return (utxo_index_add((utxo_index_t *) arg, (utxo_t *) node));
+	(void)idx;
+}
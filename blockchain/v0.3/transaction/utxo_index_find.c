@@ -0,0 +1,77 @@
+#include "transaction.h"
+
+/**
+ * utxo_index_hash - Computes the hash table key of an unspent output
+ * @tx_id: ID of the transaction containing the output
+ * @out_hash: Hash of the output
+ *
+ * Description: Both values are already SHA-256 digests, so a few of their
+ * bytes are spread evenly enough to be used as they are. The transaction
+ * ID is mixed in, as outputs sending the same amount to the same address
+ * share the same hash (e.g. all the coinbase outputs of a miner).
+ *
+ * Return: Hash table key
+*/
+size_t utxo_index_hash(uint8_t const tx_id[SHA256_DIGEST_LENGTH],
+					   uint8_t const out_hash[SHA256_DIGEST_LENGTH])
+{
+	size_t a, b;
+
+	memcpy(&a, tx_id, sizeof(a));
+	memcpy(&b, out_hash, sizeof(b));
+
+	return (a ^ b);
+}
+
+/**
+ * utxo_index_find - Finds the unspent output referenced by an input
+ * @index: Pointer to the index to search
+ * @in: Transaction input referencing the output
+ *
+ * Return: Pointer to the matching unspent output, or NULL if not found
+*/
+utxo_t *utxo_index_find(utxo_index_t const *index, tx_in_t const *in)
+{
+	utxo_slot_t *slot;
+
+	if (!index || !in)
+		return (NULL);
+
+	slot = probe_get(&index->outputs, &utxo_index_ops,
+					 utxo_index_hash(in->tx_id, in->tx_out_hash),
+					 utxo_slot_is, in);
+	return (slot ? slot->utxo : NULL);
+}
+
+/**
+ * utxo_index_remove - Removes the unspent output referenced by an input
+ * @index: Pointer to the index to update
+ * @in: Transaction input referencing the output
+ *
+ * Description: Only the index and the outputs of the address are updated,
+ * the output is neither freed nor removed from the indexed list
+ * (see utxo_index_unlist).
+ *
+ * Return: Pointer to the removed unspent output, or NULL if not found
+*/
+utxo_t *utxo_index_remove(utxo_index_t *index, tx_in_t const *in)
+{
+	utxo_slot_t *slot;
+	utxo_t *utxo;
+	size_t i;
+
+	if (!index || !in)
+		return (NULL);
+
+	i = probe_lookup(&index->outputs, &utxo_index_ops,
+					 utxo_index_hash(in->tx_id, in->tx_out_hash),
+					 utxo_slot_is, in);
+	if (i >= index->outputs.capacity)
+		return (NULL);
+
+	slot = probe_at(&index->outputs, &utxo_index_ops, i);
+	utxo = slot->utxo;
+	utxo_index_unset(index, i);
+
+	return (utxo);
+}
@@ -0,0 +1,78 @@
+#include "transaction.h"
+
+/* Defined after */
+int utxo_slot_state(void const *slot);
+size_t utxo_slot_hash(void const *slot);
+void utxo_slot_bury(void *slot);
+
+probe_ops_t const utxo_index_ops = {
+	sizeof(utxo_slot_t), utxo_slot_state, utxo_slot_hash, utxo_slot_bury
+};
+
+/**
+ * utxo_slot_state - Tells whether a slot of an index is used
+ * @slot: void pointer to the utxo_slot_t
+ *
+ * Return: PROBE_EMPTY, PROBE_DELETED for UTXO_INDEX_TOMBSTONE,
+ *		   PROBE_USED otherwise
+*/
+int utxo_slot_state(void const *slot)
+{
+	utxo_t const *utxo = ((utxo_slot_t const *) slot)->utxo;
+
+	if (!utxo)
+		return (PROBE_EMPTY);
+	return (utxo == UTXO_INDEX_TOMBSTONE ? PROBE_DELETED : PROBE_USED);
+}
+
+/**
+ * utxo_slot_hash - Computes the hash table key of the output of a slot
+ * @slot: void pointer to the used utxo_slot_t
+ *
+ * Return: Hash table key, see utxo_index_hash()
+*/
+size_t utxo_slot_hash(void const *slot)
+{
+	utxo_t const *utxo = ((utxo_slot_t const *) slot)->utxo;
+
+	return (utxo_index_hash(utxo->tx_id, utxo->out.hash));
+}
+
+/**
+ * utxo_slot_bury - Marks the slot of a removed output
+ * @slot: void pointer to the used utxo_slot_t
+*/
+void utxo_slot_bury(void *slot)
+{
+	((utxo_slot_t *) slot)->utxo = UTXO_INDEX_TOMBSTONE;
+}
+
+/**
+ * utxo_slot_is - Checks whether the output of a slot is the one referenced
+ *				  by an input
+ * @slot: void pointer to the used utxo_slot_t
+ * @key: void pointer to the tx_in_t
+ *
+ * Return: 1 if the input references the output, 0 otherwise
+*/
+int utxo_slot_is(void const *slot, void const *key)
+{
+	utxo_t const *utxo = ((utxo_slot_t const *) slot)->utxo;
+	tx_in_t const *in = key;
+
+	return (!memcmp(utxo->out.hash, in->tx_out_hash, SHA256_DIGEST_LENGTH) &&
+			!memcmp(utxo->tx_id, in->tx_id, SHA256_DIGEST_LENGTH) &&
+			!memcmp(utxo->block_hash, in->block_hash, SHA256_DIGEST_LENGTH));
+}
+
+/**
+ * utxo_slot_holds - Checks whether a slot points to a given output
+ * @slot: void pointer to the used utxo_slot_t
+ * @key: void pointer to the utxo_t, compared by address
+ *
+ * Return: 1 if the slot points to the output, 0 otherwise
+*/
+int utxo_slot_holds(void const *slot, void const *key)
+{
+	return (((utxo_slot_t const *) slot)->utxo == key);
+}
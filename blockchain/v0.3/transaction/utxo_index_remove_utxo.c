@@ -0,0 +1,58 @@
+#include "transaction.h"
+
+/**
+ * utxo_index_remove_utxo - Removes an unspent output from an index,
+ *							given its address
+ * @index: Pointer to the index to update
+ * @utxo: Unspent output to remove, compared by address
+ *
+ * Description: Unlike utxo_index_remove(), no output hash is compared,
+ * the slot holding utxo is found by address. The output is neither freed
+ * nor removed from the indexed list.
+ *
+ * Return: 1 if utxo was removed, 0 if it was not indexed
+*/
+int utxo_index_remove_utxo(utxo_index_t *index, utxo_t const *utxo)
+{
+	size_t i;
+
+	if (!index || !utxo)
+		return (0);
+
+	i = utxo_index_slot(index, utxo);
+	if (i >= index->outputs.capacity)
+		return (0);
+
+	utxo_index_unset(index, i);
+	return (1);
+}
+
+/**
+ * utxo_index_slot - Finds the slot holding an unspent output
+ * @index: Pointer to the index to search
+ * @utxo: Unspent output to look for, compared by address
+ *
+ * Return: Slot of utxo, or index->outputs.capacity if it is not indexed
+*/
+size_t utxo_index_slot(utxo_index_t const *index, utxo_t const *utxo)
+{
+	return (probe_lookup(&index->outputs, &utxo_index_ops,
+						 utxo_index_hash(utxo->tx_id, utxo->out.hash),
+						 utxo_slot_holds, utxo));
+}
+
+/**
+ * utxo_index_unset - Marks a slot of an index as removed, and removes its
+ *					  unspent output from the outputs of its address
+ * @index: Pointer to the index to update
+ * @i: Slot of an indexed unspent output
+*/
+void utxo_index_unset(utxo_index_t *index, size_t i)
+{
+	utxo_slot_t *slot = probe_at(&index->outputs, &utxo_index_ops, i);
+	utxo_t *utxo = slot->utxo;
+	size_t pos = slot->pos;
+
+	probe_release(&index->outputs, &utxo_index_ops, i);
+	utxo_address_remove(index, utxo, pos);
+}
@@ -0,0 +1,41 @@
+#include "transaction.h"
+
+/**
+ * utxo_index_unlist - Removes an unspent output from the indexed list,
+ *					   and frees it
+ * @index: Pointer to the index of all_unspent, utxo already removed
+ * @all_unspent: Indexed list of unspent transaction outputs, holding utxo
+ * @utxo: Unspent output to remove
+ *
+ * Description: llist_remove_node() only unlinks the head of a list
+ * correctly, and would walk the list to find utxo. Instead, the output at
+ * the head of the list is copied into the record of utxo, and the head is
+ * popped, so the order of all_unspent is not kept. The slot and the
+ * address of the moved output are pointed at its new record.
+*/
+void utxo_index_unlist(utxo_index_t *index, llist_t *all_unspent,
+					   utxo_t *utxo)
+{
+	utxo_t *head = llist_pop(all_unspent);
+	utxo_address_t *address;
+	utxo_slot_t *slot;
+	size_t i;
+
+	if (!head)
+		return;
+
+	if (head != utxo)
+	{
+		i = utxo_index_slot(index, head);
+		*utxo = *head;
+		if (i < index->outputs.capacity)
+		{
+			slot = probe_at(&index->outputs, &utxo_index_ops, i);
+			slot->utxo = utxo;
+			address = utxo_index_address(index, utxo->out.pub);
+			address->utxos[slot->pos] = utxo;
+		}
+	}
+
+	free(head);
+}
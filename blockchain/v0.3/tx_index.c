@@ -0,0 +1,97 @@
+#include "blockchain.h"
+
+/**
+ * chain_index_add - Indexes the Block appended to an indexed chain, and
+ *					 its transactions
+ * @index: Pointer to the index to update
+ * @block: Block to add, at the height following the last indexed Block
+ *
+ * Description: The tables are grown for the transactions of the Block
+ * first, so nothing can fail once the Block is indexed.
+ *
+ * Return: 0 on success, -1 on failure, the indexed content being untouched
+*/
+int chain_index_add(chain_index_t *index, block_t *block)
+{
+	tx_indexer_t indexer;
+	size_t s;
+
+	if (!index || !block)
+		return (-1);
+
+	memset(&indexer, 0, sizeof(indexer));
+	indexer.index = index, indexer.nthreads = 1;
+	indexer.height = index->nb_blocks;
+	if (block->transactions &&
+		block_for_each_tx(block, count_tx, &indexer) == -1)
+		return (-1);
+	for (s = 0; s < TX_INDEX_SHARDS; s++)
+	{
+		if (indexer.counts[s] &&
+			probe_reserve(&index->tx_shards[s], &tx_index_ops,
+						  indexer.counts[s]) == -1)
+			return (-1);
+	}
+
+	if (chain_index_add_block(index, block) == -1)
+		return (-1);
+	if (block->transactions)
+		block_for_each_tx(block, insert_tx, &indexer);
+	return (0);
+}
+
+/**
+ * count_tx - Counts a transaction in the table of its ID, if the table is
+ *			  filled by the current thread
+ * @node: void pointer to the transaction
+ * @idx: position of the transaction in its Block (unused)
+ * @arg: void pointer to the tx_indexer_t of the thread
+ *
+ * Return: 0
+*/
+int count_tx(llist_node_t node, unsigned int idx, void *arg)
+{
+	tx_indexer_t *indexer = arg;
+	size_t s = TX_INDEX_SHARD(((transaction_t *) node)->id);
+
+	if (s % indexer->nthreads == indexer->thread)
+		indexer->counts[s]++;
+	return (0);
+	(void)idx;
+}
+
+/**
+ * insert_tx - Adds a transaction to the table of its ID, if the table is
+ *			   filled by the current thread
+ * @node: void pointer to the transaction
+ * @idx: position of the transaction in its Block
+ * @arg: void pointer to the tx_indexer_t of the thread, holding the height
+ *		 of the Block
+ *
+ * Description: The table must have been grown by probe_reserve() for
+ * the transaction beforehand. A transaction of the same ID already indexed
+ * keeps being found first.
+ *
+ * Return: 0
+*/
+int insert_tx(llist_node_t node, unsigned int idx, void *arg)
+{
+	tx_indexer_t *indexer = arg;
+	transaction_t *tx = node;
+	size_t s = TX_INDEX_SHARD(tx->id), i;
+	probe_table_t *shard = &indexer->index->tx_shards[s];
+	tx_location_t *slot;
+
+	if (s % indexer->nthreads != indexer->thread)
+		return (0);
+
+	i = probe_find(shard, &tx_index_ops, tx_index_hash(tx->id),
+				   tx_location_is, tx->id);
+	slot = probe_at(shard, &tx_index_ops, i);
+	if (slot->tx)
+		return (0);
+
+	slot = probe_claim(shard, &tx_index_ops, i);
+	slot->tx = tx, slot->height = indexer->height, slot->pos = idx;
+	return (0);
+}
@@ -0,0 +1,106 @@
+#include "blockchain.h"
+
+/* Defined after */
+void *build_tx_shards(void *arg);
+
+/**
+ * tx_index_build - Indexes the transactions of the Blocks of a chain index
+ *					on several threads
+ * @index: Chain index, holding its Blocks but none of their transactions
+ * @nthreads: Number of threads, 0 to use every online CPU
+ *
+ * Description: Each thread fills its own tables of transactions, so no
+ * lock is taken. Every thread reads every Block, but only hashes the
+ * transactions of its tables.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int tx_index_build(chain_index_t *index, unsigned int nthreads)
+{
+	tx_indexer_t *indexers;
+	pthread_t *threads;
+	unsigned int i, started = 0;
+	int failed = 0;
+
+	if (nthreads == 0)
+		nthreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+	if (nthreads > TX_INDEX_SHARDS)
+		nthreads = TX_INDEX_SHARDS;
+	/* Not worth starting threads for a few Blocks */
+	if (nthreads == 0 || index->nb_blocks < BLOCK_LOADER_CHUNK)
+		nthreads = 1;
+
+	indexers = calloc(nthreads, sizeof(*indexers));
+	threads = nthreads > 1 ? calloc(nthreads - 1, sizeof(*threads)) : NULL;
+	if (!indexers || (nthreads > 1 && !threads))
+	{
+		free(indexers), free(threads);
+		return (-1);
+	}
+
+	for (i = 0; i < nthreads; i++)
+	{
+		indexers[i].index = index;
+		indexers[i].thread = i, indexers[i].nthreads = nthreads;
+	}
+	/* The calling thread fills the tables of indexers[0] */
+	for (i = 1; i < nthreads; i++, started++)
+		if (pthread_create(&threads[i - 1], NULL, build_tx_shards,
+						   &indexers[i]) != 0)
+			break;
+	for (; i < nthreads; i++)
+		build_tx_shards(&indexers[i]);
+	build_tx_shards(&indexers[0]);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	for (i = 0; i < nthreads; i++)
+		failed |= indexers[i].failed;
+	free(indexers), free(threads);
+	return (failed ? -1 : 0);
+}
+
+/**
+ * build_tx_shards - Thread routine, indexes the transactions of the tables
+ *					 of a thread
+ * @arg: Pointer to the tx_indexer_t of the thread
+ *
+ * Description: The transactions of the tables are counted first, so each
+ * table is grown once.
+ *
+ * Return: NULL
+*/
+void *build_tx_shards(void *arg)
+{
+	tx_indexer_t *indexer = arg;
+	chain_index_t *index = indexer->index;
+	block_t *block;
+	size_t s;
+	uint32_t h;
+
+	for (h = 0; h < index->nb_blocks; h++)
+	{
+		block = index->blocks[h];
+		indexer->height = h;
+		if (block->transactions)
+			block_for_each_tx(block, count_tx, indexer);
+	}
+	for (s = indexer->thread; s < TX_INDEX_SHARDS; s += indexer->nthreads)
+	{
+		if (probe_reserve(&index->tx_shards[s], &tx_index_ops,
+						  indexer->counts[s]) == -1)
+		{
+			indexer->failed = 1;
+			return (NULL);
+		}
+	}
+
+	for (h = 0; h < index->nb_blocks; h++)
+	{
+		block = index->blocks[h];
+		indexer->height = h;
+		if (block->transactions)
+			block_for_each_tx(block, insert_tx, indexer);
+	}
+	return (NULL);
+}
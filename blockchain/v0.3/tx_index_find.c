@@ -0,0 +1,79 @@
+#include "blockchain.h"
+
+/**
+ * tx_index_hash - Hashes a transaction ID into a slot number
+ * @tx_id: ID of the transaction
+ *
+ * Description: The first byte of the ID picks its table, the following
+ * bytes are used instead.
+ *
+ * Return: Hash value, to be masked by the capacity of the table
+*/
+size_t tx_index_hash(uint8_t const *tx_id)
+{
+	size_t h;
+
+	memcpy(&h, tx_id + 1, sizeof(h));
+	return (h);
+}
+
+/**
+ * blockchain_get_tx - Finds a transaction of a Blockchain by its ID
+ * @blockchain: Pointer to the Blockchain
+ * @tx_id: ID of the transaction, SHA256_DIGEST_LENGTH bytes long
+ * @height: If not NULL, receives the height of the Block holding it
+ * @pos: If not NULL, receives its position in the transactions of the Block
+ *
+ * Description: Like blockchain_get_block_at(), the chain index is caught
+ * up with the chain first.
+ *
+ * Return: Pointer to the transaction, or NULL if not found or if the chain
+ *		   index could not be updated
+*/
+transaction_t *blockchain_get_tx(blockchain_t const *blockchain,
+								 uint8_t const *tx_id, uint32_t *height,
+								 uint32_t *pos)
+{
+	tx_location_t *slot;
+
+	if (!blockchain || !tx_id || !blockchain->chain_index ||
+		chain_index_sync(blockchain->chain_index, blockchain->chain) == -1)
+		return (NULL);
+
+	slot = probe_get(&blockchain->chain_index->tx_shards[TX_INDEX_SHARD(tx_id)],
+					 &tx_index_ops, tx_index_hash(tx_id), tx_location_is,
+					 tx_id);
+	if (!slot)
+		return (NULL);
+
+	if (height)
+		*height = slot->height;
+	if (pos)
+		*pos = slot->pos;
+	return (slot->tx);
+}
+
+/**
+ * blockchain_input_is_anchored - Checks that an input refers to a
+ *								  transaction of a Blockchain, in the Block
+ *								  it names
+ * @blockchain: Pointer to the Blockchain
+ * @in: Transaction input to check
+ *
+ * Description: Only where the spent output comes from is checked, not
+ * whether it is still unspent.
+ *
+ * Return: 1 if the transaction tx_id of the input is in the Block
+ *		   block_hash, 0 otherwise
+*/
+int blockchain_input_is_anchored(blockchain_t const *blockchain,
+								 tx_in_t const *in)
+{
+	uint32_t height;
+
+	if (!in || !blockchain_get_tx(blockchain, in->tx_id, &height, NULL))
+		return (0);
+
+	return (!memcmp(blockchain->chain_index->blocks[height]->hash,
+					in->block_hash, SHA256_DIGEST_LENGTH));
+}
@@ -0,0 +1,45 @@
+#include "blockchain.h"
+
+/* Defined after */
+int tx_location_state(void const *slot);
+size_t tx_location_hash(void const *slot);
+
+probe_ops_t const tx_index_ops = {
+	sizeof(tx_location_t), tx_location_state, tx_location_hash, NULL
+};
+
+/**
+ * tx_location_state - Tells whether a slot of a transaction table is used
+ * @slot: void pointer to the tx_location_t
+ *
+ * Return: PROBE_USED if the slot holds a transaction, PROBE_EMPTY otherwise
+*/
+int tx_location_state(void const *slot)
+{
+	return (((tx_location_t const *) slot)->tx ? PROBE_USED : PROBE_EMPTY);
+}
+
+/**
+ * tx_location_hash - Computes the hash table key of the transaction of
+ *					  a slot
+ * @slot: void pointer to the used tx_location_t
+ *
+ * Return: Hash table key, see tx_index_hash()
+*/
+size_t tx_location_hash(void const *slot)
+{
+	return (tx_index_hash(((tx_location_t const *) slot)->tx->id));
+}
+
+/**
+ * tx_location_is - Checks whether the transaction of a slot has a given ID
+ * @slot: void pointer to the used tx_location_t
+ * @key: ID to look for, SHA256_DIGEST_LENGTH bytes long
+ *
+ * Return: 1 if the transaction has this ID, 0 otherwise
+*/
+int tx_location_is(void const *slot, void const *key)
+{
+	return (!memcmp(((tx_location_t const *) slot)->tx->id, key,
+					SHA256_DIGEST_LENGTH));
+}
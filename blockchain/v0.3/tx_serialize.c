@@ -0,0 +1,135 @@
+#include "blockchain.h"
+
+/* Defined after */
+int tx_in_serialize(llist_node_t node, unsigned int idx, void *arg);
+int tx_out_serialize(llist_node_t node, unsigned int idx, void *arg);
+int tx_serialized_size(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * tx_serialize - serializes a transaction
+ * @node: void pointer to the transaction to serialize
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the writer
+ *
+ * Return: 0 if success, otherwise -1
+*/
+int tx_serialize(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t *tx = node;
+	int32_t nb_inputs, nb_outputs;
+
+	if (!tx)
+		return (-1);
+
+	nb_inputs = llist_size(tx->inputs);
+	nb_outputs = llist_size(tx->outputs);
+
+	if (HBLK_ENDIAN == 2)
+	{
+		SWAPENDIAN(nb_inputs);
+		SWAPENDIAN(nb_outputs);
+	}
+
+	hblk_writer_write(arg, tx->id, SHA256_DIGEST_LENGTH);
+	hblk_writer_write(arg, &nb_inputs, sizeof(nb_inputs));
+	if (hblk_writer_write(arg, &nb_outputs, sizeof(nb_outputs)) == -1)
+		return (-1);
+
+	/* Packed inputs are written at once, tx_in_t only holds bytes */
+	if (TX_INPUTS_PACKED(tx) && tx->nb_inputs > 0)
+	{
+		if (hblk_writer_write(arg, tx->input_array,
+							  tx->nb_inputs * sizeof(tx_in_t)) == -1)
+			return (-1);
+	}
+	else if (llist_for_each(tx->inputs, tx_in_serialize, arg) == -1)
+		return (-1);
+
+	if (tx_outputs_for_each(tx, tx_out_serialize, arg) == -1)
+		return (-1);
+
+	return (0);
+	(void)idx;
+}
+
+/**
+ * tx_in_serialize - serializes a transaction input
+ * @node: void pointer to the tx_in_t to serialize
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the writer
+ *
+ * Return: 0 if success, otherwise -1
+*/
+int tx_in_serialize(llist_node_t node, unsigned int idx, void *arg)
+{
+	return (hblk_writer_write(arg, node, sizeof(tx_in_t)));
+	(void)idx;
+}
+
+/**
+ * tx_out_serialize - serializes a transaction output
+ * @node: void pointer to the tx_out_t to serialize
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the writer
+ *
+ * Return: 0 if success, otherwise -1
+*/
+int tx_out_serialize(llist_node_t node, unsigned int idx, void *arg)
+{
+	tx_out_t *tx_out = node;
+	uint32_t amount = tx_out->amount;
+
+	if (HBLK_ENDIAN == 2)
+		SWAPENDIAN(amount);
+
+	hblk_writer_write(arg, &amount, sizeof(amount));
+	hblk_writer_write(arg, tx_out->pub, EC_PUB_LEN);
+	return (hblk_writer_write(arg, tx_out->hash, SHA256_DIGEST_LENGTH));
+	(void)idx;
+}
+
+/**
+ * block_serialized_size - Computes the size of a serialized Block
+ * @block: Block to measure
+ * @versioned: 1 if the version of the Block is written
+ *
+ * Return: Number of bytes written by block_serialize() for block
+*/
+size_t block_serialized_size(block_t const *block, int versioned)
+{
+	size_t size;
+
+	size = sizeof(block->info) + sizeof(block->data.len) + block->data.len +
+		   SHA256_DIGEST_LENGTH + sizeof(int32_t);
+	if (versioned)
+		size += sizeof(block->version);
+	if (block->transactions)
+		block_for_each_tx(block, tx_serialized_size, &size);
+
+	return (size);
+}
+
+/**
+ * tx_serialized_size - Adds the size of a serialized transaction to a total
+ * @node: void pointer to the transaction
+ * @idx: index of the node (unused)
+ * @arg: void pointer to the size_t total
+ *
+ * Return: 0
+*/
+int tx_serialized_size(llist_node_t node, unsigned int idx, void *arg)
+{
+	transaction_t const *tx = node;
+	int nb_inputs = llist_size(tx->inputs);
+	int nb_outputs = llist_size(tx->outputs);
+
+	*(size_t *) arg += SHA256_DIGEST_LENGTH + 2 * sizeof(int32_t);
+	if (nb_inputs > 0)
+		*(size_t *) arg += nb_inputs * sizeof(tx_in_t);
+	if (nb_outputs > 0)
+		*(size_t *) arg += nb_outputs *
+						   (sizeof(uint32_t) + EC_PUB_LEN + SHA256_DIGEST_LENGTH);
+
+	return (0);
+	(void)idx;
+}
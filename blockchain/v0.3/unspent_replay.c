@@ -0,0 +1,119 @@
+#include "blockchain.h"
+
+/* Defined after */
+int collect_block(llist_node_t node, unsigned int idx, void *arg);
+
+/**
+ * blockchain_blocks - Lists the Blocks of a Blockchain in an array
+ * @blockchain: Pointer to the Blockchain
+ * @nb_blocks: Pointer receiving the number of Blocks
+ *
+ * Return: Allocated array of the Blocks, in order, or NULL on failure
+*/
+block_t **blockchain_blocks(blockchain_t const *blockchain,
+							int32_t *nb_blocks)
+{
+	block_t **blocks;
+
+	if (!blockchain || !nb_blocks)
+		return (NULL);
+
+	*nb_blocks = llist_size(blockchain->chain);
+	if (*nb_blocks <= 0)
+		return (NULL);
+
+	blocks = malloc(*nb_blocks * sizeof(*blocks));
+	if (blocks && llist_for_each(blockchain->chain, collect_block, blocks) == -1)
+	{
+		free(blocks);
+		return (NULL);
+	}
+
+	return (blocks);
+}
+
+/**
+ * collect_block - Stores a Block in an array
+ * @node: void pointer to the block_t
+ * @idx: index of the node, also its position in the array
+ * @arg: void pointer to the array of block_t pointers
+ *
+ * Return: 0
+*/
+int collect_block(llist_node_t node, unsigned int idx, void *arg)
+{
+	((block_t **)arg)[idx] = node;
+	return (0);
+}
+
+/**
+ * unspent_replay - Builds the unspent outputs of a chain of Blocks, by
+ *					applying the transactions of each Block in turn
+ * @blocks: Array of the Blocks, in order
+ * @nb_blocks: Number of Blocks
+ * @index: Pointer receiving the hash index of the returned list
+ *
+ * Description: The Blocks are only read, so that the replay can run in
+ * another thread while new Blocks are appended to their Blockchain.
+ *
+ * Return: List of the unspent outputs, or NULL on failure
+*/
+llist_t *unspent_replay(block_t *const *blocks, int32_t nb_blocks,
+						utxo_index_t **index)
+{
+	llist_t *unspent = llist_create(MT_SUPPORT_FALSE), *updated;
+	int32_t i;
+
+	*index = utxo_index_create(NULL);
+	for (i = 0; unspent && *index && i < nb_blocks; i++)
+	{
+		/* The Genesis Block has no transaction */
+		if (!blocks[i]->transactions)
+			continue;
+		updated = update_unspent_indexed(blocks[i]->transactions,
+										 blocks[i]->hash, unspent, *index);
+		if (!updated)
+			break;
+		unspent = updated;
+	}
+
+	if (!unspent || !*index || i < nb_blocks)
+	{
+		if (unspent)
+			llist_destroy(unspent, 1, NULL);
+		utxo_index_destroy(*index);
+		*index = NULL;
+		return (NULL);
+	}
+
+	return (unspent);
+}
+
+/**
+ * blockchain_rebuild_unspent - Replaces the unspent outputs of a Blockchain
+ *								by the ones replayed from its Blocks
+ * @blockchain: Pointer to the Blockchain
+ *
+ * Return: 0 on success, -1 on failure, the unspent outputs being untouched
+*/
+int blockchain_rebuild_unspent(blockchain_t *blockchain)
+{
+	utxo_index_t *index;
+	llist_t *unspent;
+	block_t **blocks;
+	int32_t nb_blocks;
+
+	blocks = blockchain_blocks(blockchain, &nb_blocks);
+	if (!blocks)
+		return (-1);
+	unspent = unspent_replay(blocks, nb_blocks, &index);
+	free(blocks);
+	if (!unspent)
+		return (-1);
+
+	llist_destroy(blockchain->unspent, 1, NULL);
+	utxo_index_destroy(blockchain->unspent_index);
+	blockchain->unspent = unspent;
+	blockchain->unspent_index = index;
+	return (0);
+}
@@ -0,0 +1,127 @@
+#include "blockchain.h"
+
+/**
+ * utxo_snapshot_write - Writes the commitment to the unspent outputs of a
+ *						 Blockchain file
+ * @path: Path of the Blockchain file, the commitment is written to path.utxo
+ * @blockchain: Blockchain just written to path, or NULL to remove the
+ *				commitment
+ * @file_size: Size of the Blockchain file
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int utxo_snapshot_write(char const *path, blockchain_t const *blockchain,
+						uint64_t file_size)
+{
+	char *utxo_path = hblk_path_suffix(path, UTXO_SNAPSHOT_SUFFIX);
+	uint8_t commitment[SHA256_DIGEST_LENGTH], endian = HBLK_ENDIAN;
+	int32_t nb_blocks, nb_unspent;
+	hblk_writer_t writer;
+	block_t *tip;
+
+	if (!utxo_path)
+		return (-1);
+	tip = blockchain ? llist_get_tail(blockchain->chain) : NULL;
+	if (!tip || !utxo_commitment(blockchain->unspent, commitment) ||
+		hblk_writer_open(&writer, utxo_path) == -1)
+	{
+		remove(utxo_path);
+		free(utxo_path);
+		return (blockchain ? -1 : 0);
+	}
+	free(utxo_path);
+
+	nb_blocks = llist_size(blockchain->chain);
+	nb_unspent = llist_size(blockchain->unspent);
+	hblk_writer_write(&writer, UTXO_SNAPSHOT_MAGIC, LEN_MAGIC);
+	hblk_writer_write(&writer, HBLK_VERSION, LEN_VERSION);
+	hblk_writer_write(&writer, &endian, sizeof(endian));
+	hblk_writer_write(&writer, &file_size, sizeof(file_size));
+	hblk_writer_write(&writer, &nb_blocks, sizeof(nb_blocks));
+	hblk_writer_write(&writer, tip->hash, SHA256_DIGEST_LENGTH);
+	hblk_writer_write(&writer, &nb_unspent, sizeof(nb_unspent));
+	hblk_writer_write(&writer, commitment, SHA256_DIGEST_LENGTH);
+
+	return (hblk_writer_close(&writer));
+}
+
+/**
+ * utxo_snapshot_read - Reads the commitment to the unspent outputs of a
+ *						Blockchain file
+ * @path: Path of the Blockchain file, the commitment is read from path.utxo
+ * @file_size: Size of the Blockchain file
+ * @snapshot: Pointer receiving the commitment
+ *
+ * Description: The commitment is discarded if it was written for a file
+ * of another size.
+ *
+ * Return: 0 on success, -1 if there is no usable commitment
+*/
+int utxo_snapshot_read(char const *path, uint64_t file_size,
+					   utxo_snapshot_t *snapshot)
+{
+	char *utxo_path = hblk_path_suffix(path, UTXO_SNAPSHOT_SUFFIX);
+	hblk_reader_t reader;
+	int ok;
+
+	if (!utxo_path || !snapshot || hblk_reader_open(&reader, utxo_path) == -1)
+	{
+		free(utxo_path);
+		return (-1);
+	}
+	free(utxo_path);
+
+	reader.endian = reader.len > LEN_MAGIC + LEN_VERSION ?
+					reader.base[LEN_MAGIC + LEN_VERSION] : 0;
+	ok = reader.len >= UTXO_SNAPSHOT_HEADER_LEN &&
+		 !memcmp(reader.base, UTXO_SNAPSHOT_MAGIC, LEN_MAGIC) &&
+		 !memcmp(reader.base + LEN_MAGIC, HBLK_VERSION, LEN_VERSION) &&
+		 hblk_reader_take(&reader, LEN_MAGIC + LEN_VERSION + 1) &&
+		 hblk_reader_uint64(&reader, &snapshot->file_size) == 0 &&
+		 snapshot->file_size == file_size &&
+		 hblk_reader_int32(&reader, &snapshot->nb_blocks) == 0 &&
+		 hblk_reader_read(&reader, snapshot->tip, SHA256_DIGEST_LENGTH) == 0 &&
+		 hblk_reader_int32(&reader, &snapshot->nb_unspent) == 0 &&
+		 hblk_reader_read(&reader, snapshot->commitment,
+						  SHA256_DIGEST_LENGTH) == 0;
+
+	munmap(reader.base, reader.len);
+	return (ok ? 0 : -1);
+}
+
+/**
+ * blockchain_check_unspent - Checks the unspent outputs of a Blockchain
+ *							  loaded from a file against its commitment
+ * @blockchain: Blockchain loaded from path
+ * @path: Path of the Blockchain file
+ *
+ * Description: The unspent outputs are sorted and hashed once, in a single
+ * pass. They are only rebuilt by replaying every Block if they don't match
+ * the commitment. A file without a commitment, or whose commitment was
+ * written for another version of it, is trusted as is.
+ *
+ * Return: 0 if the unspent outputs were kept, 1 if they were rebuilt,
+ *		   -1 on failure
+*/
+int blockchain_check_unspent(blockchain_t *blockchain, char const *path)
+{
+	uint8_t commitment[SHA256_DIGEST_LENGTH];
+	utxo_snapshot_t snapshot;
+	block_t *tip;
+
+	if (!blockchain || !path)
+		return (-1);
+
+	tip = llist_get_tail(blockchain->chain);
+	if (!tip || utxo_snapshot_read(path, blockchain->map_len, &snapshot) == -1 ||
+		snapshot.nb_blocks != llist_size(blockchain->chain) ||
+		memcmp(snapshot.tip, tip->hash, SHA256_DIGEST_LENGTH))
+		return (0);
+
+	if (snapshot.nb_unspent == llist_size(blockchain->unspent) &&
+		utxo_commitment(blockchain->unspent, commitment) &&
+		!memcmp(commitment, snapshot.commitment, SHA256_DIGEST_LENGTH))
+		return (0);
+
+	return (blockchain_rebuild_unspent(blockchain) == -1 ? -1 : 1);
+}
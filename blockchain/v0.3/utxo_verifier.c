@@ -0,0 +1,118 @@
+#include "blockchain.h"
+
+/* Defined after */
+void *verify_unspent(void *arg);
+
+/**
+ * utxo_verifier_start - Starts checking the unspent outputs of a
+ *						 Blockchain against a full replay of its Blocks,
+ *						 in a background thread
+ * @blockchain: Pointer to the Blockchain
+ *
+ * Description: The Blocks and the commitment of the unspent outputs are
+ * taken now, in the calling thread. Blocks can then be appended to the
+ * Blockchain while the check runs, but the Blockchain must not be
+ * destroyed before utxo_verifier_destroy() is called.
+ *
+ * Return: Pointer to the running verifier, or NULL on failure
+*/
+utxo_verifier_t *utxo_verifier_start(blockchain_t const *blockchain)
+{
+	utxo_verifier_t *verifier;
+
+	if (!blockchain)
+		return (NULL);
+
+	verifier = calloc(1, sizeof(*verifier));
+	if (!verifier)
+		return (NULL);
+
+	verifier->blocks = blockchain_blocks(blockchain, &verifier->nb_blocks);
+	if (!verifier->blocks ||
+		!utxo_commitment(blockchain->unspent, verifier->expected))
+	{
+		free(verifier->blocks);
+		free(verifier);
+		return (NULL);
+	}
+
+	verifier->status = UTXO_CHECK_RUNNING;
+	pthread_mutex_init(&verifier->lock, NULL);
+	if (pthread_create(&verifier->thread, NULL, verify_unspent, verifier))
+	{
+		pthread_mutex_destroy(&verifier->lock);
+		free(verifier->blocks);
+		free(verifier);
+		return (NULL);
+	}
+
+	return (verifier);
+}
+
+/**
+ * verify_unspent - Thread routine, replays the Blocks and compares the
+ *					resulting unspent outputs to the expected ones
+ * @arg: Pointer to the utxo_verifier_t
+ *
+ * Return: NULL
+*/
+void *verify_unspent(void *arg)
+{
+	utxo_verifier_t *verifier = arg;
+	uint8_t commitment[SHA256_DIGEST_LENGTH];
+	utxo_index_t *index;
+	llist_t *unspent;
+	int status = UTXO_CHECK_FAILED;
+
+	unspent = unspent_replay(verifier->blocks, verifier->nb_blocks, &index);
+	if (unspent && utxo_commitment(unspent, commitment) &&
+		!memcmp(commitment, verifier->expected, SHA256_DIGEST_LENGTH))
+		status = UTXO_CHECK_PASSED;
+
+	if (unspent)
+	{
+		llist_destroy(unspent, 1, NULL);
+		utxo_index_destroy(index);
+	}
+
+	pthread_mutex_lock(&verifier->lock);
+	verifier->status = status;
+	pthread_mutex_unlock(&verifier->lock);
+	return (NULL);
+}
+
+/**
+ * utxo_verifier_status - Gets the result of a background check
+ * @verifier: Pointer to the verifier
+ *
+ * Return: UTXO_CHECK_RUNNING, UTXO_CHECK_PASSED or UTXO_CHECK_FAILED
+*/
+int utxo_verifier_status(utxo_verifier_t *verifier)
+{
+	int status;
+
+	if (!verifier)
+		return (UTXO_CHECK_FAILED);
+
+	pthread_mutex_lock(&verifier->lock);
+	status = verifier->status;
+	pthread_mutex_unlock(&verifier->lock);
+
+	return (status);
+}
+
+/**
+ * utxo_verifier_destroy - Waits for a background check to end, and
+ *						   deletes its verifier
+ * @verifier: Pointer to the verifier, may be NULL
+*/
+void utxo_verifier_destroy(utxo_verifier_t *verifier)
+{
+	if (!verifier)
+		return;
+
+	pthread_join(verifier->thread, NULL);
+	pthread_mutex_destroy(&verifier->lock);
+	free(verifier->blocks);
+	free(verifier);
+}
@@ -17,7 +17,8 @@ blockchain_context_t *blockchain_context_create(void)
 
 	bchain_ctx->blockchain = blockchain_create();
 	bchain_ctx->wallet = ec_create();
-	bchain_ctx->transaction_pool = llist_create(MT_SUPPORT_FALSE);
+	bchain_ctx->transaction_pool = mempool_create();
+	bchain_ctx->verifier = NULL;
 
 	if (!bchain_ctx->blockchain || !bchain_ctx->wallet ||
 		!bchain_ctx->transaction_pool)
@@ -37,9 +38,10 @@ blockchain_context_t *blockchain_context_create(void)
 */
 void blockchain_context_destroy(blockchain_context_t *bchain_ctx)
 {
+	/* The background check reads the Blocks, it must end first */
+	utxo_verifier_destroy(bchain_ctx->verifier);
 	blockchain_destroy(bchain_ctx->blockchain);
 	EC_KEY_free(bchain_ctx->wallet);
-	llist_destroy(bchain_ctx->transaction_pool, 1,
-				  (node_dtor_t) transaction_destroy);
+	mempool_destroy(bchain_ctx->transaction_pool);
 	free(bchain_ctx);
 }
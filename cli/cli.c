@@ -9,6 +9,8 @@ static command_t cmds[] = {
 	{"info", info},
 	{"load", load},
 	{"save", save},
+	{"verify", verify},
+	{"tx", tx},
 	{"exit", cli_exit},
 	{"quit", cli_quit},
 	{NULL, NULL}
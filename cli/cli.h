@@ -18,13 +18,16 @@
  *								 current wallet, and current transaction pool
  * @blockchain: pointer to current blockchain in use
  * @wallet: pointer to current wallet in use
- * @transaction_pool: local list of the current pending transactions
+ * @transaction_pool: local mempool of the current pending transactions
+ * @verifier: background check of the unspent outputs of the blockchain,
+ *			  or NULL if none was started
 */
 typedef struct blockchain_context_s
 {
 	blockchain_t *blockchain;
 	EC_KEY *wallet;
-	llist_t *transaction_pool;
+	mempool_t *transaction_pool;
+	utxo_verifier_t *verifier;
 } blockchain_context_t;
 
 /**
@@ -73,6 +76,8 @@ int mine(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
 int info(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
 int save(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
 int load(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
+int verify(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
+int tx(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
 
 /* exit_commands.c */
 int cli_exit(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
@@ -81,11 +86,13 @@ int cli_quit(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx);
 /* utility_functions.c */
 int is_positive_number(const char *string);
 uint8_t *hex_str_to_pub(char *string);
+int hex_str_to_buf(char const *string, uint8_t *buf, size_t len);
 
 
 /* blockchain provided functions in blockchain/v0.3/provided */
 void _blockchain_print(blockchain_t const *blockchain);
 void _blockchain_print_brief(blockchain_t const *blockchain);
+void _transaction_print(transaction_t const *transaction);
 
 
 #endif /* CLI_H */
@@ -11,6 +11,10 @@
  *		.Display the number of Blocks in the Blockchain
  *		.Display the number of unspent transaction output
  *		.Display the number of pending transactions in the local transaction pool
+ *		.Display the balance of the wallet, i.e. the total amount of the
+ *		 unspent outputs sent to its public key
+ *		.Display the hit and miss counters of the shared public key cache
+ *		.Display the result of the last verify command, if any
  *
  * Return: 1 if success, otherwise 0
  *
@@ -18,7 +22,11 @@
 int info(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 {
 	blockchain_t *blockchain = bchain_ctx->blockchain;
-	llist_t *transaction_pool = bchain_ctx->transaction_pool;
+	mempool_t *transaction_pool = bchain_ctx->transaction_pool;
+	utxo_address_t *address;
+	uint8_t pub[EC_PUB_LEN];
+	unsigned long hits, misses;
+	char const *check[] = {"failed", "running", "passed"};
 
 	if (cmd_ctx->argc != 1)
 	{
@@ -29,7 +37,17 @@ int info(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 	printf("Number of blocks: %i\n", llist_size(blockchain->chain));
 	printf("Number of unspent transaction outputs: %i\n",
 		   llist_size(blockchain->unspent));
-	printf("Number of pending transactions: %i\n", llist_size(transaction_pool));
+	printf("Number of pending transactions: %lu\n",
+		   (unsigned long) transaction_pool->size);
+	address = utxo_index_address(blockchain->unspent_index,
+								 ec_to_pub(bchain_ctx->wallet, pub));
+	printf("Balance of the wallet: %lu\n",
+		   address ? (unsigned long) address->balance : 0);
+	ec_cache_stats(NULL, &hits, &misses);
+	printf("Public key cache: %lu hits, %lu misses\n", hits, misses);
+	if (bchain_ctx->verifier)
+		printf("Unspent outputs check: %s\n",
+			   check[utxo_verifier_status(bchain_ctx->verifier) + 1]);
 	_blockchain_print_brief(blockchain);
 
 	return (1);
@@ -11,6 +11,12 @@
  *
  * Description:
  *		.Override the local blockchain
+ *		.The file is mapped in memory and parsed in place, its Blocks
+ *		 being loaded and checked on every online CPU if it has an index
+ *		.Check its unspent outputs against the commitment saved with it,
+ *		 they are only rebuilt from its Blocks if they don't match
+ *		.Append the Blocks saved to its log since the file was written
+ *		.Delete the pending transactions not valid in the loaded blockchain
  *
 */
 int load(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
@@ -26,15 +32,19 @@ int load(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 
 	path = cmd_ctx->args[0];
 
-	loaded_blockchain = blockchain_deserialize(path);
+	loaded_blockchain = blockchain_load(path, 0);
 	if (!loaded_blockchain)
 	{
 		fprintf(stderr, "Couldn't load the blockchain\n");
 		return (0);
 	}
 
+	utxo_verifier_destroy(bchain_ctx->verifier);
+	bchain_ctx->verifier = NULL;
 	blockchain_destroy(bchain_ctx->blockchain);
 	bchain_ctx->blockchain = loaded_blockchain;
+	mempool_revalidate(bchain_ctx->transaction_pool,
+					   loaded_blockchain->unspent_index);
 
 	return (1);
 }
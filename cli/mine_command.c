@@ -14,17 +14,17 @@ int add_transactions(block_t *block, blockchain_context_t *bchain_ctx);
  *		.Create a new Block using the Blockchain API
  *
  *		.IF transactions are available in the local transaction pool,
- *		 include the transactions 1 by 1 in the Block:
- *			..Verify the transaction using the list of unspent outputs
- *			..If the transaction is not valid, do not include it in the Block,
- *			  and delete it
- *			..Update the list of unspent outputs after a transaction is processed
+ *		 move them to the Block, oldest first. They were verified when
+ *		 they were sent, and spend distinct outputs
  *
  *		.Set the difficulty of the Block using the difficulty adjustment method
- *		.Inject a coinbase transaction as the first transaction in the Block
- *		.Mine the Block (proof of work)
- *		.Verify Block validity
- *		.Add the Block to the Blockchain
+ *		.Inject a coinbase transaction as the first transaction in the Block,
+ *		 allocated from the arena of the Block
+ *		.Mine the Block (proof of work) using the number of threads given
+ *		 as argument, or every online CPU if omitted
+ *		.Verify Block validity, the signatures being verified on the same
+ *		 number of threads, and add the Block to the Blockchain along with
+ *		 its outputs, in a single pass
  *
  * Return: 1 if success, otherwise 0
  *
@@ -34,13 +34,16 @@ int mine(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 	blockchain_t *blockchain = bchain_ctx->blockchain;
 	block_t *last_block = llist_get_tail(blockchain->chain);
 	block_t *new_block;
+	unsigned int nthreads = 0;
 
-
-	if (cmd_ctx->argc != 1)
+	if (cmd_ctx->argc > 2 ||
+		(cmd_ctx->argc == 2 && !is_positive_number(cmd_ctx->args[0])))
 	{
-		fprintf(stderr, "Usage: mine\n");
+		fprintf(stderr, "Usage: mine [<nb_threads>]\n");
 		return (0);
 	}
+	if (cmd_ctx->argc == 2)
+		nthreads = atoi(cmd_ctx->args[0]);
 
 	/* Create new block */
 	new_block = block_create(last_block, NULL, 0);
@@ -51,21 +54,17 @@ int mine(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 	}
 	new_block->info.difficulty = blockchain_difficulty(blockchain);
 
-	add_transactions(new_block, bchain_ctx);
+	if (!add_transactions(new_block, bchain_ctx))
+		return (0);
 
-	block_mine(new_block);
-	if (block_is_valid(new_block, last_block, blockchain->unspent) == -1)
+	block_mine_parallel(new_block, nthreads);
+	if (block_apply(blockchain, new_block, nthreads) == -1)
 	{
 		fprintf(stderr, "Invalid block, mining cancelled\n");
 		block_destroy(new_block);
 		return (0);
 	}
 
-	llist_add_node(blockchain->chain, new_block, ADD_NODE_REAR);
-
-	blockchain->unspent = update_unspent(new_block->transactions,
-										 new_block->hash, blockchain->unspent);
-
 	printf("Block mined\n");
 
 	return (1);
@@ -73,7 +72,7 @@ int mine(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 
 /**
  * add_transactions - Add transactions to the block to mine
- * @block: pointer to block to add transactions to
+ * @block: pointer to block to add transactions to, destroyed on failure
  * @bchain_ctx: pointer to blockchain context structure containing
  *				the blockchain, the wallet, and the transaction pool
  *
@@ -81,11 +80,11 @@ int mine(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 */
 int add_transactions(block_t *block, blockchain_context_t *bchain_ctx)
 {
-	blockchain_t *blockchain = bchain_ctx->blockchain;
-	transaction_t *coinbase_tx, *tx_pool_head;
+	transaction_t *coinbase_tx;
 
-	/* Add coinbase transaction */
-	coinbase_tx = coinbase_create(bchain_ctx->wallet, block->info.index);
+	/* Add coinbase transaction, allocated along with the block */
+	coinbase_tx = coinbase_create_in(block->arena, bchain_ctx->wallet,
+									 block->info.index);
 	if (coinbase_is_valid(coinbase_tx, block->info.index) == 0)
 	{
 		fprintf(stderr, "Invalid coinbase transaction, mining cancelled\n");
@@ -94,20 +93,10 @@ int add_transactions(block_t *block, blockchain_context_t *bchain_ctx)
 	}
 	llist_add_node(block->transactions, coinbase_tx, ADD_NODE_FRONT);
 
-	/* Add all valid transactions from local pool if any */
-	tx_pool_head = llist_pop(bchain_ctx->transaction_pool);
-	while (tx_pool_head)
-	{
-		if (transaction_is_valid(tx_pool_head, blockchain->unspent) == 1)
-			llist_add_node(block->transactions, tx_pool_head, ADD_NODE_REAR);
-		else
-		{
-			printf("Invalid transaction removed from local pool\n");
-			transaction_destroy(tx_pool_head);
-		}
-
-		tx_pool_head = llist_pop(bchain_ctx->transaction_pool);
-	}
+	/* Add all transactions from local pool if any */
+	if (mempool_template(bchain_ctx->transaction_pool, block,
+						 bchain_ctx->transaction_pool->size) == -1)
+		fprintf(stderr, "Couldn't add the pending transactions\n");
 
 	return (1);
 }
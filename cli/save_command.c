@@ -8,14 +8,18 @@
  *			   the wallet, and the transaction pool
  *
  * Description:
- *		.If the file exists, override it
+ *		.If the file holds an earlier state of the blockchain, only append
+ *		 the new Blocks to its log, otherwise override it
+ *		.Print the number of bytes written and the throughput of the save
  *
  * Return: 1 if success, otherwise 0
 */
 int save(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 {
 	blockchain_t *blockchain = bchain_ctx->blockchain;
-	char *path;
+	struct timespec start, end;
+	size_t written = 0;
+	double seconds;
 
 	if (cmd_ctx->argc != 2)
 	{
@@ -23,13 +27,20 @@ int save(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 		return (0);
 	}
 
-	path = cmd_ctx->args[0];
-
-	if (blockchain_serialize(blockchain, path) == -1)
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (blockchain_save_incremental(blockchain, cmd_ctx->args[0],
+									&written) == -1)
 	{
 		fprintf(stderr, "Couldn't save the blockchain\n");
 		return (0);
 	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	seconds = (end.tv_sec - start.tv_sec) +
+			  (end.tv_nsec - start.tv_nsec) / 1e9;
+	printf("Saved %lu bytes in %.3f ms (%.1f MB/s)\n",
+		   (unsigned long)written, seconds * 1e3,
+		   seconds > 0 ? written / seconds / 1e6 : 0.0);
 
 	return (1);
 }
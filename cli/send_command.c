@@ -12,9 +12,11 @@ int generate_local_transaction(EC_KEY * receiver, size_t amount,
  *			   the wallet, and the transaction pool
  *
  * Description:
- *		.Create a new transaction
- *		.Verify the transaction validity
- *		.Add transaction to a local list (transaction pool)
+ *		.Create a new transaction, spending only the outputs of the wallet
+ *		 no pending transaction spends yet
+ *		.Add transaction to the local mempool (transaction pool), which
+ *		 verifies the transaction validity, and rejects it if it spends
+ *		 an output already spent by a pending transaction
  *		.Do not update list of unspent
  *
  * Return: 1 if success, otherwise 0
@@ -43,7 +45,7 @@ int send(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
 
 	address = cmd_ctx->args[1];
 	pub_receiver = hex_str_to_pub(address);
-	receiver = ec_from_pub(pub_receiver);
+	receiver = ec_from_pub_cached(pub_receiver);
 	free(pub_receiver);
 	if (!receiver)
 	{
@@ -70,17 +72,17 @@ int generate_local_transaction(EC_KEY *receiver, size_t amount,
 	EC_KEY *sender = bchain_ctx->wallet;
 	transaction_t *transaction;
 
+	transaction = mempool_transaction_create(bchain_ctx->transaction_pool,
+											 sender, receiver, amount,
+											 blockchain->unspent_index);
 
-	transaction = transaction_create(sender, receiver, amount,
-									 blockchain->unspent);
-
-	if (transaction_is_valid(transaction, blockchain->unspent) == 0)
+	if (mempool_add(bchain_ctx->transaction_pool, transaction,
+					blockchain->unspent_index) != 1)
 	{
 		fprintf(stderr, "Invalid transaction\n");
 		transaction_destroy(transaction);
 		return (0);
 	}
-	llist_add_node(bchain_ctx->transaction_pool, transaction, ADD_NODE_REAR);
 
 	return (1);
 }
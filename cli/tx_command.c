@@ -0,0 +1,52 @@
+#include "cli.h"
+
+/**
+ * tx - Display a transaction of the Blockchain, and the Block holding it
+ *
+ * @cmd_ctx: command context structure containing the arguments
+ * @bchain_ctx: blockchain context structure containing the blockchain,
+ *			   the wallet, and the transaction pool
+ *
+ * Description:
+ *		.Usage: tx <id>
+ *		.<id> is the ID of the transaction, in hexadecimal
+ *		.Display the height and the hash of the Block holding the
+ *		 transaction, its position in the Block, then the transaction
+ *
+ * Return: 1 if success, otherwise 0
+*/
+int tx(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
+{
+	uint8_t tx_id[SHA256_DIGEST_LENGTH];
+	transaction_t *transaction;
+	block_t *block;
+	uint32_t height, pos;
+	size_t i;
+
+	if (cmd_ctx->argc != 2)
+	{
+		fprintf(stderr, "Usage: tx <id>\n");
+		return (0);
+	}
+	if (hex_str_to_buf(cmd_ctx->args[0], tx_id, sizeof(tx_id)) == -1)
+	{
+		fprintf(stderr, "Wrong transaction ID\n");
+		return (0);
+	}
+
+	transaction = blockchain_get_tx(bchain_ctx->blockchain, tx_id,
+									&height, &pos);
+	if (!transaction)
+	{
+		fprintf(stderr, "Transaction not found\n");
+		return (0);
+	}
+
+	block = blockchain_get_block_at(bchain_ctx->blockchain, height);
+	printf("Block: %u, hash: ", height);
+	for (i = 0; i < SHA256_DIGEST_LENGTH; i++)
+		printf("%02x", block->hash[i]);
+	printf("\nPosition in the Block: %u\n", pos);
+	_transaction_print(transaction);
+	return (1);
+}
@@ -56,3 +56,30 @@ uint8_t *hex_str_to_pub(char *hex_string)
 
 	return (octet_string);
 }
+
+/**
+ * hex_str_to_buf - Converts an ASCII-encoded hexadecimal string into a
+ *					buffer of a given size
+ * @hex_string: The string to convert
+ * @buf: Buffer receiving the bytes
+ * @len: Size of @buf, the string must be twice as long
+ *
+ * Return: 0 if success, -1 if the string is not @len bytes in hexadecimal
+*/
+int hex_str_to_buf(char const *hex_string, uint8_t *buf, size_t len)
+{
+	char hex_byte[3] = {0};
+	size_t i;
+
+	if (!hex_string || strlen(hex_string) != len * 2 ||
+		strspn(hex_string, "0123456789abcdefABCDEF") != len * 2)
+		return (-1);
+
+	for (i = 0; i < len; i++)
+	{
+		hex_byte[0] = hex_string[2 * i], hex_byte[1] = hex_string[2 * i + 1];
+		buf[i] = (uint8_t)strtol(hex_byte, NULL, 16);
+	}
+
+	return (0);
+}
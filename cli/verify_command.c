@@ -0,0 +1,43 @@
+#include "cli.h"
+
+/**
+ * verify - Check the unspent outputs by replaying the whole Blockchain
+ *
+ * @cmd_ctx: command context structure containing the arguments
+ * @bchain_ctx: blockchain context structure containing the blockchain,
+ *			   the wallet, and the transaction pool
+ *
+ * Description:
+ *		.Start replaying every Block of the Blockchain in a background
+ *		 thread, and compare the resulting unspent outputs to the current
+ *		 ones, the CLI staying usable in the meantime
+ *		.The result of the check is displayed by the info command
+ *
+ * Return: 1 if success, otherwise 0
+*/
+int verify(command_context_t *cmd_ctx, blockchain_context_t *bchain_ctx)
+{
+	if (cmd_ctx->argc != 1)
+	{
+		fprintf(stderr, "Usage: verify\n");
+		return (0);
+	}
+
+	if (bchain_ctx->verifier &&
+		utxo_verifier_status(bchain_ctx->verifier) == UTXO_CHECK_RUNNING)
+	{
+		fprintf(stderr, "A check is already running\n");
+		return (0);
+	}
+
+	utxo_verifier_destroy(bchain_ctx->verifier);
+	bchain_ctx->verifier = utxo_verifier_start(bchain_ctx->blockchain);
+	if (!bchain_ctx->verifier)
+	{
+		fprintf(stderr, "Couldn't start checking the unspent outputs\n");
+		return (0);
+	}
+
+	printf("Checking the unspent outputs in the background\n");
+	return (1);
+}
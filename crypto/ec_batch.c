@@ -0,0 +1,158 @@
+#include "hblk_crypto.h"
+
+/**
+ * ec_batch_create - Creates an empty batch of signatures
+ *
+ * Return: Pointer to the created batch, or NULL on failure
+*/
+ec_batch_t *ec_batch_create(void)
+{
+	ec_batch_t *batch = calloc(1, sizeof(*batch));
+	int ok;
+	size_t i;
+
+	if (!batch)
+		return (NULL);
+
+	batch->group = EC_GROUP_new_by_curve_name(EC_CURVE);
+	batch->ctx = BN_CTX_new();
+	batch->g_scalar = BN_new();
+	ok = batch->group && batch->ctx && batch->g_scalar;
+	for (i = 0; ok && i < EC_VERIFY_BATCH; i++)
+	{
+		batch->scalars[2 * i] = BN_new();
+		batch->scalars[2 * i + 1] = BN_new();
+		batch->nonces[i] = EC_POINT_new(batch->group);
+		ok = batch->scalars[2 * i] && batch->scalars[2 * i + 1] &&
+			 batch->nonces[i];
+	}
+	if (!ok)
+	{
+		ec_batch_destroy(batch);
+		return (NULL);
+	}
+
+	BN_zero(batch->g_scalar);
+	return (batch);
+}
+
+/**
+ * ec_batch_destroy - Deletes a batch of signatures
+ * @batch: Pointer to the batch to delete
+*/
+void ec_batch_destroy(ec_batch_t *batch)
+{
+	size_t i;
+
+	if (!batch)
+		return;
+
+	ec_batch_clear(batch);
+	for (i = 0; i < EC_VERIFY_BATCH; i++)
+	{
+		BN_free(batch->scalars[2 * i]);
+		BN_free(batch->scalars[2 * i + 1]);
+		EC_POINT_free(batch->nonces[i]);
+	}
+	BN_free(batch->g_scalar);
+	BN_CTX_free(batch->ctx);
+	EC_GROUP_free(batch->group);
+	free(batch);
+}
+
+/**
+ * ec_batch_clear - Removes every signature from a batch
+ * @batch: Pointer to the batch to clear
+*/
+void ec_batch_clear(ec_batch_t *batch)
+{
+	size_t i;
+
+	for (i = 0; i < batch->size; i++)
+		EC_KEY_free(batch->keys[i]);
+	batch->size = 0;
+	BN_zero(batch->g_scalar);
+}
+
+/**
+ * ec_batch_add - Adds a signature to a batch
+ * @batch: Pointer to the batch
+ * @item: Signature to add, along with the public key and the message
+ *
+ * Description: The first signature is weighted by 1, the next ones by a
+ * random number of EC_BATCH_RAND_BITS bits, so invalid signatures cannot
+ * be forged to cancel each other out.
+ *
+ * Return: 1 on success, 0 if the batch is full, or if the signature is
+ *		   malformed or has no nonce point of x-coordinate r
+*/
+int ec_batch_add(ec_batch_t *batch, ec_verify_item_t const *item)
+{
+	BIGNUM const *order = EC_GROUP_get0_order(batch->group);
+	BIGNUM *r, *s, *u1, *u2, *a;
+	size_t i = batch->size;
+	EC_KEY *key;
+	int ok;
+
+	if (i == EC_VERIFY_BATCH)
+		return (0);
+	key = ec_from_pub_cached(item->pub);
+	if (!key)
+		return (0);
+
+	BN_CTX_start(batch->ctx);
+	r = BN_CTX_get(batch->ctx), s = BN_CTX_get(batch->ctx);
+	u1 = BN_CTX_get(batch->ctx), u2 = BN_CTX_get(batch->ctx);
+	a = BN_CTX_get(batch->ctx);
+	ok = a && item->msg && item->sig &&
+		 ec_sig_decode(item->sig, order, r, s) &&
+		 ec_sig_scalars(order, item->msg, item->msglen, r, s, u1, u2,
+						batch->ctx) &&
+		 EC_POINT_set_compressed_coordinates(batch->group, batch->nonces[i],
+											 r, 0, batch->ctx) &&
+		 (i ? BN_rand(a, EC_BATCH_RAND_BITS, BN_RAND_TOP_ONE,
+					  BN_RAND_BOTTOM_ANY) : BN_one(a)) &&
+		 BN_mod_mul(u1, u1, a, order, batch->ctx) &&
+		 BN_mod_add(batch->g_scalar, batch->g_scalar, u1, order, batch->ctx) &&
+		 BN_mod_mul(batch->scalars[2 * i], u2, a, order, batch->ctx) &&
+		 BN_sub(batch->scalars[2 * i + 1], order, a);
+	BN_CTX_end(batch->ctx);
+	if (!ok)
+	{
+		EC_KEY_free(key);
+		return (0);
+	}
+
+	batch->points[2 * i] = EC_KEY_get0_public_key(key);
+	batch->points[2 * i + 1] = batch->nonces[i];
+	batch->keys[i] = key;
+	batch->size++;
+	return (1);
+}
+
+/**
+ * ec_batch_check - Checks every signature of a batch at once, then clears it
+ * @batch: Pointer to the batch
+ *
+ * Description: The generator, the public keys and the nonce points are
+ * multiplied by their scalars and summed by a single multi-scalar
+ * multiplication, which shares its doublings between all the signatures.
+ *
+ * Return: 1 if the batch holds, meaning all its signatures are valid,
+ *		   0 otherwise
+*/
+int ec_batch_check(ec_batch_t *batch)
+{
+	EC_POINT *sum = EC_POINT_new(batch->group);
+	int ok;
+
+	ok = sum && batch->size &&
+		 EC_POINTs_mul(batch->group, sum, batch->g_scalar, 2 * batch->size,
+					   batch->points, (BIGNUM const **)batch->scalars,
+					   batch->ctx) &&
+		 EC_POINT_is_at_infinity(batch->group, sum);
+
+	EC_POINT_free(sum);
+	ec_batch_clear(batch);
+	return (ok);
+}
@@ -0,0 +1,113 @@
+#include "hblk_crypto.h"
+
+/* Defined in ec_cache_lru.c */
+ec_cache_entry_t **ec_cache_find(ec_cache_t *cache,
+								 uint8_t const pub[EC_PUB_LEN]);
+void ec_cache_unlink(ec_cache_t *cache, ec_cache_entry_t *entry);
+void ec_cache_push_front(ec_cache_t *cache, ec_cache_entry_t *entry);
+void ec_cache_insert(ec_cache_t *cache, uint8_t const pub[EC_PUB_LEN],
+					 EC_KEY *key);
+
+/**
+ * ec_cache_create - Creates a cache of EC_KEY decoded from public keys
+ * @capacity: Maximum number of cached keys
+ *
+ * Return: Pointer to the created cache, or NULL on failure
+*/
+ec_cache_t *ec_cache_create(size_t capacity)
+{
+	ec_cache_t *cache;
+
+	if (!capacity)
+		return (NULL);
+
+	cache = calloc(1, sizeof(*cache));
+	if (!cache)
+		return (NULL);
+
+	cache->capacity = capacity;
+	for (cache->nb_buckets = 1; cache->nb_buckets < capacity;)
+		cache->nb_buckets *= 2;
+	cache->buckets = calloc(cache->nb_buckets, sizeof(*cache->buckets));
+	if (!cache->buckets)
+	{
+		free(cache);
+		return (NULL);
+	}
+
+	pthread_mutex_init(&cache->lock, NULL);
+	return (cache);
+}
+
+/**
+ * ec_cache_destroy - Deletes a cache, and releases its keys
+ * @cache: Pointer to the cache to delete
+ *
+ * Keys previously returned by ec_cache_get() stay valid, as each of them
+ * holds its own reference.
+*/
+void ec_cache_destroy(ec_cache_t *cache)
+{
+	ec_cache_entry_t *entry, *next;
+
+	if (!cache)
+		return;
+
+	for (entry = cache->head; entry; entry = next)
+	{
+		next = entry->next;
+		EC_KEY_free(entry->key);
+		free(entry);
+	}
+
+	pthread_mutex_destroy(&cache->lock);
+	free(cache->buckets);
+	free(cache);
+}
+
+/**
+ * ec_cache_get - Gets the EC_KEY of a public key, decoding it only if it is
+ *				  not cached yet
+ * @cache: Pointer to the cache to use
+ * @pub: Public key to get the EC_KEY of
+ *
+ * Description: The public key is decoded without holding the lock,
+ * so threads missing different keys don't wait for each other.
+ *
+ * Return: New reference to the EC_KEY, to be released with EC_KEY_free(),
+ *		   or NULL on failure
+*/
+EC_KEY *ec_cache_get(ec_cache_t *cache, uint8_t const pub[EC_PUB_LEN])
+{
+	ec_cache_entry_t *entry;
+	EC_KEY *key;
+
+	if (!cache || !pub)
+		return (NULL);
+
+	pthread_mutex_lock(&cache->lock);
+	entry = *ec_cache_find(cache, pub);
+	if (entry)
+	{
+		/* Mark as the most recently used entry */
+		ec_cache_unlink(cache, entry);
+		ec_cache_push_front(cache, entry);
+		cache->hits++;
+		key = entry->key;
+		EC_KEY_up_ref(key);
+		pthread_mutex_unlock(&cache->lock);
+		return (key);
+	}
+	cache->misses++;
+	pthread_mutex_unlock(&cache->lock);
+
+	key = ec_from_pub(pub);
+	if (!key)
+		return (NULL);
+
+	pthread_mutex_lock(&cache->lock);
+	ec_cache_insert(cache, pub, key);
+	pthread_mutex_unlock(&cache->lock);
+
+	return (key);
+}
@@ -0,0 +1,68 @@
+#include "hblk_crypto.h"
+
+/* Cache shared by every user of ec_from_pub_cached() */
+static ec_cache_t *default_cache;
+static pthread_once_t default_cache_once = PTHREAD_ONCE_INIT;
+
+/**
+ * ec_cache_default_init - Creates the shared cache, called once
+*/
+static void ec_cache_default_init(void)
+{
+	default_cache = ec_cache_create(EC_CACHE_DEFAULT_SIZE);
+}
+
+/**
+ * ec_cache_default - Gets the EC_KEY cache shared by the whole process
+ *
+ * Description: The cache holds up to EC_CACHE_DEFAULT_SIZE keys,
+ * and lives until the process exits.
+ *
+ * Return: Pointer to the shared cache, or NULL if it could not be created
+*/
+ec_cache_t *ec_cache_default(void)
+{
+	pthread_once(&default_cache_once, ec_cache_default_init);
+	return (default_cache);
+}
+
+/**
+ * ec_from_pub_cached - Creates an EC_KEY structure given a public key,
+ *						through the shared cache
+ * @pub: Contains the public key to be converted
+ *
+ * Description: Same as ec_from_pub(), but a key decoded recently is reused.
+ * Falls back to ec_from_pub() if the shared cache could not be created.
+ *
+ * Return: Pointer to the EC_KEY, to be released with EC_KEY_free(),
+ *		   or NULL upon failure
+*/
+EC_KEY *ec_from_pub_cached(uint8_t const pub[EC_PUB_LEN])
+{
+	ec_cache_t *cache = ec_cache_default();
+
+	if (!cache)
+		return (ec_from_pub(pub));
+
+	return (ec_cache_get(cache, pub));
+}
+
+/**
+ * ec_cache_stats - Reads the hit and miss counters of a cache
+ * @cache: Pointer to the cache, NULL for the shared one
+ * @hits: Receives the number of lookups answered from the cache
+ * @misses: Receives the number of lookups that had to decode the key
+*/
+void ec_cache_stats(ec_cache_t *cache, unsigned long *hits,
+					unsigned long *misses)
+{
+	*hits = 0, *misses = 0;
+	if (!cache)
+		cache = ec_cache_default();
+	if (!cache)
+		return;
+
+	pthread_mutex_lock(&cache->lock);
+	*hits = cache->hits, *misses = cache->misses;
+	pthread_mutex_unlock(&cache->lock);
+}
@@ -0,0 +1,105 @@
+#include "hblk_crypto.h"
+
+/* Defined after */
+ec_cache_entry_t **ec_cache_find(ec_cache_t *cache,
+								 uint8_t const pub[EC_PUB_LEN]);
+void ec_cache_unlink(ec_cache_t *cache, ec_cache_entry_t *entry);
+void ec_cache_push_front(ec_cache_t *cache, ec_cache_entry_t *entry);
+
+/**
+ * ec_cache_find - Finds a public key in a cache
+ * @cache: Pointer to the cache to search, locked by the caller
+ * @pub: Public key to look for
+ *
+ * Return: Pointer to the link pointing to the matching entry, or to the
+ *		   NULL link ending the bucket of pub if it is not cached
+*/
+ec_cache_entry_t **ec_cache_find(ec_cache_t *cache,
+								 uint8_t const pub[EC_PUB_LEN])
+{
+	ec_cache_entry_t **link;
+	size_t h;
+
+	/* Skip the leading 0x04 of the uncompressed point, the rest is random */
+	memcpy(&h, pub + 1, sizeof(h));
+	link = &cache->buckets[h & (cache->nb_buckets - 1)];
+	while (*link && memcmp((*link)->pub, pub, EC_PUB_LEN) != 0)
+		link = &(*link)->chain;
+
+	return (link);
+}
+
+/**
+ * ec_cache_unlink - Removes an entry from the recently used list
+ * @cache: Pointer to the cache, locked by the caller
+ * @entry: Entry to remove, it stays in its hash bucket
+*/
+void ec_cache_unlink(ec_cache_t *cache, ec_cache_entry_t *entry)
+{
+	if (entry->prev)
+		entry->prev->next = entry->next;
+	else
+		cache->head = entry->next;
+
+	if (entry->next)
+		entry->next->prev = entry->prev;
+	else
+		cache->tail = entry->prev;
+
+	entry->prev = NULL, entry->next = NULL;
+}
+
+/**
+ * ec_cache_push_front - Inserts an entry as the most recently used one
+ * @cache: Pointer to the cache, locked by the caller
+ * @entry: Entry to insert, not in the recently used list
+*/
+void ec_cache_push_front(ec_cache_t *cache, ec_cache_entry_t *entry)
+{
+	entry->prev = NULL, entry->next = cache->head;
+	if (cache->head)
+		cache->head->prev = entry;
+	else
+		cache->tail = entry;
+	cache->head = entry;
+}
+
+/**
+ * ec_cache_insert - Caches a decoded key, evicting the least recently used
+ *					 one if the cache is full
+ * @cache: Pointer to the cache to update, locked by the caller
+ * @pub: Public key key was decoded from
+ * @key: Decoded key, a new reference is taken by the cache
+*/
+void ec_cache_insert(ec_cache_t *cache, uint8_t const pub[EC_PUB_LEN],
+					 EC_KEY *key)
+{
+	ec_cache_entry_t *entry, **link;
+
+	/* Another thread may have cached it in the meantime */
+	if (*ec_cache_find(cache, pub))
+		return;
+
+	if (cache->size == cache->capacity)
+	{
+		/* Evict the least recently used entry, and reuse it */
+		entry = cache->tail;
+		link = ec_cache_find(cache, entry->pub);
+		*link = entry->chain;
+		ec_cache_unlink(cache, entry);
+		EC_KEY_free(entry->key);
+		cache->size--;
+	}
+	else
+	{
+		entry = malloc(sizeof(*entry));
+		if (!entry)
+			return;
+	}
+
+	memcpy(entry->pub, pub, EC_PUB_LEN);
+	entry->key = key, EC_KEY_up_ref(key);
+	entry->chain = NULL, *ec_cache_find(cache, pub) = entry;
+	ec_cache_push_front(cache, entry);
+	cache->size++;
+}
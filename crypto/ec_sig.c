@@ -0,0 +1,186 @@
+#include "hblk_crypto.h"
+
+/* Defined after */
+int ec_sig_digest(BIGNUM const *order, uint8_t const *msg, size_t msglen,
+				  BIGNUM *e);
+
+/**
+ * ec_sig_decode - Decodes the two numbers of a DER encoded signature
+ * @sig: Points to the signature to decode
+ * @order: Order of the curve
+ * @r: Receives the x-coordinate of the nonce point, modulo order
+ * @s: Receives the proof of the signature
+ *
+ * Description: Like ECDSA_verify(), signatures followed by extra bytes or
+ * not encoded the canonical way are rejected.
+ *
+ * Return: 1 if both numbers are in [1, order - 1], 0 otherwise
+*/
+int ec_sig_decode(sig_t const *sig, BIGNUM const *order, BIGNUM *r,
+				  BIGNUM *s)
+{
+	uint8_t const *p = sig->sig;
+	uint8_t der[SIG_MAX_LEN], *q = der;
+	BIGNUM const *sig_r, *sig_s;
+	ECDSA_SIG *ecdsa_sig;
+	int ok = 0;
+
+	if (sig->len > SIG_MAX_LEN)
+		return (0);
+	ecdsa_sig = d2i_ECDSA_SIG(NULL, &p, sig->len);
+	if (!ecdsa_sig)
+		return (0);
+
+	if (p == sig->sig + sig->len &&
+		i2d_ECDSA_SIG(ecdsa_sig, NULL) == sig->len &&
+		i2d_ECDSA_SIG(ecdsa_sig, &q) == sig->len &&
+		!memcmp(der, sig->sig, sig->len))
+	{
+		ECDSA_SIG_get0(ecdsa_sig, &sig_r, &sig_s);
+		ok = !BN_is_zero(sig_r) && !BN_is_negative(sig_r) &&
+			 BN_cmp(sig_r, order) < 0 && !BN_is_zero(sig_s) &&
+			 !BN_is_negative(sig_s) && BN_cmp(sig_s, order) < 0 &&
+			 BN_copy(r, sig_r) && BN_copy(s, sig_s);
+	}
+
+	ECDSA_SIG_free(ecdsa_sig);
+	return (ok);
+}
+
+/**
+ * ec_sig_encode - DER encodes the two numbers of a signature
+ * @r: x-coordinate of the nonce point, modulo the order of the curve
+ * @s: Proof of the signature
+ * @sig: Receives the encoded signature
+ *
+ * Return: 1 on success, 0 on failure
+*/
+int ec_sig_encode(BIGNUM const *r, BIGNUM const *s, sig_t *sig)
+{
+	ECDSA_SIG *ecdsa_sig = ECDSA_SIG_new();
+	BIGNUM *sig_r = BN_dup(r), *sig_s = BN_dup(s);
+	uint8_t *p = sig->sig;
+	int len = 0;
+
+	if (ecdsa_sig && sig_r && sig_s &&
+		ECDSA_SIG_set0(ecdsa_sig, sig_r, sig_s))
+	{
+		sig_r = sig_s = NULL;
+		len = i2d_ECDSA_SIG(ecdsa_sig, NULL);
+		if (len > 0 && len <= SIG_MAX_LEN)
+			len = i2d_ECDSA_SIG(ecdsa_sig, &p);
+		else
+			len = 0;
+	}
+
+	BN_free(sig_r);
+	BN_free(sig_s);
+	ECDSA_SIG_free(ecdsa_sig);
+	if (len <= 0)
+		return (0);
+	sig->len = (uint8_t)len;
+	return (1);
+}
+
+/**
+ * ec_sig_scalars - Computes the scalars of the generator and of the public
+ *					key that give back the nonce point of a signature
+ * @order: Order of the curve
+ * @msg: Points to the msglen signed bytes
+ * @msglen: Length of msg
+ * @r: x-coordinate of the nonce point, modulo order
+ * @s: Proof of the signature
+ * @u1: Receives e / s, e being msg read as a number
+ * @u2: Receives r / s
+ * @ctx: Scratch numbers
+ *
+ * Description: For a valid signature by the key Q, u1 * G + u2 * Q is
+ * the nonce point.
+ *
+ * Return: 1 on success, 0 on failure
+*/
+int ec_sig_scalars(BIGNUM const *order, uint8_t const *msg, size_t msglen,
+				   BIGNUM const *r, BIGNUM const *s, BIGNUM *u1, BIGNUM *u2,
+				   BN_CTX *ctx)
+{
+	BIGNUM *e, *w;
+	int ok;
+
+	BN_CTX_start(ctx);
+	e = BN_CTX_get(ctx);
+	w = BN_CTX_get(ctx);
+	ok = w && ec_sig_digest(order, msg, msglen, e) &&
+		 BN_mod_inverse(w, s, order, ctx) &&
+		 BN_mod_mul(u1, e, w, order, ctx) && BN_mod_mul(u2, r, w, order, ctx);
+	BN_CTX_end(ctx);
+
+	return (ok);
+}
+
+/**
+ * ec_sig_normalize - Makes a signature use the nonce point of even
+ *					  y-coordinate
+ * @key: Points to the EC_KEY that made the signature
+ * @msg: Points to the msglen signed bytes
+ * @msglen: Length of msg
+ * @sig: Points to the signature to normalize
+ *
+ * Description: (r, s) and (r, order - s) are both valid, the nonce
+ * points they give back are opposite. Picking the one of even
+ * y-coordinate lets ec_verify_batch() rebuild the nonce point from r.
+ *
+ * Return: 1 on success, 0 on failure
+*/
+int ec_sig_normalize(EC_KEY const *key, uint8_t const *msg, size_t msglen,
+					 sig_t *sig)
+{
+	EC_GROUP const *group = EC_KEY_get0_group(key);
+	BIGNUM const *order = EC_GROUP_get0_order(group);
+	BN_CTX *ctx = BN_CTX_new();
+	EC_POINT *nonce = EC_POINT_new(group);
+	BIGNUM *r, *s, *u1, *u2, *y;
+	int ok = 0;
+
+	if (ctx && nonce)
+	{
+		BN_CTX_start(ctx);
+		r = BN_CTX_get(ctx), s = BN_CTX_get(ctx);
+		u1 = BN_CTX_get(ctx), u2 = BN_CTX_get(ctx), y = BN_CTX_get(ctx);
+		ok = y && ec_sig_decode(sig, order, r, s) &&
+			 ec_sig_scalars(order, msg, msglen, r, s, u1, u2, ctx) &&
+			 EC_POINT_mul(group, nonce, u1, EC_KEY_get0_public_key(key), u2,
+						  ctx) &&
+			 EC_POINT_get_affine_coordinates(group, nonce, NULL, y, ctx);
+		if (ok && BN_is_odd(y))
+			ok = BN_sub(s, order, s) && ec_sig_encode(r, s, sig);
+		BN_CTX_end(ctx);
+	}
+
+	EC_POINT_free(nonce);
+	BN_CTX_free(ctx);
+	return (ok);
+}
+
+/**
+ * ec_sig_digest - Reads signed bytes as a number, the way ECDSA does
+ * @order: Order of the curve
+ * @msg: Points to the msglen signed bytes
+ * @msglen: Length of msg
+ * @e: Receives the leftmost bits of msg, as many as order has
+ *
+ * Return: 1 on success, 0 on failure
+*/
+int ec_sig_digest(BIGNUM const *order, uint8_t const *msg, size_t msglen,
+				  BIGNUM *e)
+{
+	int bits = BN_num_bits(order);
+
+	if (msglen > (size_t)(bits + 7) / 8)
+		msglen = (bits + 7) / 8;
+	if (!BN_bin2bn(msg, msglen, e))
+		return (0);
+	if (msglen * 8 > (size_t)bits && !BN_rshift(e, e, 8 - (bits & 7)))
+		return (0);
+
+	return (1);
+}
@@ -10,6 +10,9 @@
  * Return: Pointer to the signature buffer upon success (sig->sig),
  *		   or NULL on failure.
  * If either key or msg is NULL, the function must fail.
+ *
+ * The signature is normalized by ec_sig_normalize(), so it can be checked
+ * in a batch by ec_verify_batch().
 */
 uint8_t
 *ec_sign(EC_KEY const *key, uint8_t const *msg, size_t msglen, sig_t *sig)
@@ -28,6 +31,8 @@ uint8_t
 	}
 
 	sig->len = sig_len;
+	if (!ec_sig_normalize(key, msg, msglen, sig))
+		return (NULL);
 	/* Return the signature */
 	return (sig->sig);
 }
@@ -0,0 +1,126 @@
+#include "hblk_crypto.h"
+
+/* Defined after */
+int ec_verify_batch_holds(ec_batch_t *batch, ec_verify_item_t const *items,
+						  size_t nb);
+size_t ec_verify_each(ec_verify_item_t const *items, size_t nb);
+
+/**
+ * ec_verify_batch - Verifies many signatures, EC_VERIFY_BATCH at a time
+ * @items: Signatures to verify, along with the public key and the message
+ * @nb: Number of signatures in items
+ * @failure: If not NULL, receives the lowest index of an invalid
+ *			 signature, or nb if they are all valid
+ *
+ * Description: Each group of signatures is first checked at once by an
+ * ec_batch_t. If the batch does not hold, its signatures are verified one
+ * by one with ec_verify() to find the invalid one. If they turn out to be
+ * all valid, they were not normalized by ec_sign(), and the following
+ * signatures are verified one by one too.
+ *
+ * Return: 1 if all the signatures are valid, 0 otherwise
+*/
+int ec_verify_batch(ec_verify_item_t const *items, size_t nb,
+					size_t *failure)
+{
+	ec_batch_t *batch = NULL;
+	int batching = 1;
+	size_t invalid;
+
+	if (!items && nb)
+		return (0);
+
+	if (nb > 1)
+		batch = ec_batch_create();
+	invalid = ec_verify_groups(batch, items, nb, &batching);
+	ec_batch_destroy(batch);
+	if (failure)
+		*failure = invalid;
+	return (invalid == nb);
+}
+
+/**
+ * ec_verify_groups - Verifies signatures EC_VERIFY_BATCH at a time,
+ *					  until one is invalid
+ * @batch: Pointer to an empty batch, reused for each group, or NULL to
+ *		   verify the signatures one by one
+ * @items: Signatures to verify
+ * @nb: Number of signatures in items
+ * @batching: Points to 1 to check groups at once, 0 to verify the
+ *			  signatures one by one. Set to 0 once a batch did not hold
+ *			  although its signatures are valid
+ *
+ * Return: Index of the first invalid signature, or nb if they are all valid
+*/
+size_t ec_verify_groups(ec_batch_t *batch, ec_verify_item_t const *items,
+						size_t nb, int *batching)
+{
+	size_t i, end, invalid = nb;
+	int tried;
+
+	for (i = 0; i < nb && invalid == nb; i = end)
+	{
+		end = i + EC_VERIFY_BATCH < nb ? i + EC_VERIFY_BATCH : nb;
+		tried = batch && *batching && end - i > 1;
+		if (tried && ec_verify_batch_holds(batch, items + i, end - i))
+			continue;
+		invalid = i + ec_verify_each(items + i, end - i);
+		if (invalid == end)
+		{
+			invalid = nb;
+			*batching = *batching && !tried;
+		}
+	}
+
+	return (invalid);
+}
+
+/**
+ * ec_verify_batch_holds - Checks a group of signatures at once
+ * @batch: Pointer to an empty batch
+ * @items: Signatures to check
+ * @nb: Number of signatures in items, at most EC_VERIFY_BATCH
+ *
+ * Return: 1 if all the signatures are valid, 0 if one may be invalid
+*/
+int ec_verify_batch_holds(ec_batch_t *batch, ec_verify_item_t const *items,
+						  size_t nb)
+{
+	size_t i;
+
+	for (i = 0; i < nb; i++)
+	{
+		if (!ec_batch_add(batch, &items[i]))
+		{
+			ec_batch_clear(batch);
+			return (0);
+		}
+	}
+
+	return (ec_batch_check(batch));
+}
+
+/**
+ * ec_verify_each - Verifies signatures one by one, until one is invalid
+ * @items: Signatures to verify
+ * @nb: Number of signatures in items
+ *
+ * Return: Index of the first invalid signature, or nb if they are all valid
+*/
+size_t ec_verify_each(ec_verify_item_t const *items, size_t nb)
+{
+	size_t i;
+	EC_KEY *key;
+	int valid;
+
+	for (i = 0; i < nb; i++)
+	{
+		key = ec_from_pub_cached(items[i].pub);
+		valid = ec_verify(key, items[i].msg, items[i].msglen, items[i].sig);
+		EC_KEY_free(key);
+		if (!valid)
+			break;
+	}
+
+	return (i);
+}
@@ -0,0 +1,123 @@
+#include "hblk_crypto.h"
+
+/* Defined after */
+void *ec_verify_worker(void *arg);
+size_t ec_verify_claim(ec_verify_ctx_t *ctx, size_t *end);
+void ec_verify_fail(ec_verify_ctx_t *ctx, size_t i);
+
+/**
+ * ec_verify_parallel - Verifies many signatures using several threads
+ * @items: Signatures to verify, along with the public key and the message
+ * @nb: Number of signatures in items
+ * @nthreads: Number of threads to use, 0 to use every online CPU
+ * @failure: If not NULL, receives the lowest index of an invalid
+ *			 signature, or nb if they are all valid
+ *
+ * Description: Threads claim the signatures EC_VERIFY_CHUNK at a time,
+ * in increasing order. Once an invalid signature is found, signatures
+ * located after it are not verified anymore, but the ones before it still
+ * are, so the reported index does not depend on how threads are scheduled.
+ * Each claimed chunk is checked as one batch, see ec_verify_batch(), each
+ * thread reusing its own ec_batch_t for all the chunks it claims.
+ * Public keys are decoded through the shared EC_KEY cache.
+ *
+ * Return: 1 if all the signatures are valid, 0 otherwise
+*/
+int ec_verify_parallel(ec_verify_item_t const *items, size_t nb,
+					   unsigned int nthreads, size_t *failure)
+{
+	ec_verify_ctx_t ctx;
+	pthread_t *threads = NULL;
+	unsigned int i, started = 0;
+
+	if (!items && nb)
+		return (0);
+
+	if (nthreads == 0)
+		nthreads = (unsigned int) sysconf(_SC_NPROCESSORS_ONLN);
+	if (nthreads > (nb + EC_VERIFY_CHUNK - 1) / EC_VERIFY_CHUNK)
+		nthreads = (nb + EC_VERIFY_CHUNK - 1) / EC_VERIFY_CHUNK;
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.items = items, ctx.nb = nb, ctx.failure = nb;
+	pthread_mutex_init(&ctx.lock, NULL);
+
+	/* The calling thread is one of the workers */
+	if (nthreads > 1)
+		threads = malloc((nthreads - 1) * sizeof(*threads));
+	for (i = 0; threads && i < nthreads - 1; i++, started++)
+	{
+		if (pthread_create(&threads[i], NULL, ec_verify_worker, &ctx) != 0)
+			break;
+	}
+	ec_verify_worker(&ctx);
+	for (i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	free(threads);
+	pthread_mutex_destroy(&ctx.lock);
+	if (failure)
+		*failure = ctx.failure;
+	return (ctx.failure == nb);
+}
+
+/**
+ * ec_verify_worker - Thread routine, verifies signatures until none is left
+ * @arg: Pointer to the ec_verify_ctx_t shared by the threads
+ *
+ * Return: NULL
+*/
+void *ec_verify_worker(void *arg)
+{
+	ec_verify_ctx_t *ctx = arg;
+	ec_batch_t *batch = ec_batch_create();
+	size_t i, end, invalid;
+	int batching = 1;
+
+	for (i = ec_verify_claim(ctx, &end); i < end;
+		 i = ec_verify_claim(ctx, &end))
+	{
+		invalid = ec_verify_groups(batch, ctx->items + i, end - i,
+								   &batching);
+		if (invalid < end - i)
+			ec_verify_fail(ctx, i + invalid);
+	}
+
+	ec_batch_destroy(batch);
+	return (NULL);
+}
+
+/**
+ * ec_verify_claim - Claims the next signatures to verify
+ * @ctx: State shared by the threads
+ * @end: Receives the index following the last claimed signature
+ *
+ * Return: Index of the first claimed signature, equal to *end if there is
+ *		   nothing left worth verifying
+*/
+size_t ec_verify_claim(ec_verify_ctx_t *ctx, size_t *end)
+{
+	size_t first;
+
+	pthread_mutex_lock(&ctx->lock);
+	first = ctx->next < ctx->failure ? ctx->next : ctx->failure;
+	*end = first + EC_VERIFY_CHUNK < ctx->failure ?
+		   first + EC_VERIFY_CHUNK : ctx->failure;
+	ctx->next = *end;
+	pthread_mutex_unlock(&ctx->lock);
+
+	return (first);
+}
+
+/**
+ * ec_verify_fail - Records an invalid signature
+ * @ctx: State shared by the threads
+ * @i: Index of the invalid signature
+*/
+void ec_verify_fail(ec_verify_ctx_t *ctx, size_t i)
+{
+	pthread_mutex_lock(&ctx->lock);
+	if (i < ctx->failure)
+		ctx->failure = i;
+	pthread_mutex_unlock(&ctx->lock);
+}
@@ -11,6 +11,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <pthread.h>
 
 #define EC_CURVE NID_secp256k1
 
@@ -19,6 +20,20 @@
 /* Maximum signature octet string length (using 256-bit curve) */
 #define SIG_MAX_LEN 72
 
+/* Maximum number of messages hashed at once by a multi-buffer engine */
+#define SHA256_MB_MAX_LANES 16
+
+/* Number of decoded public keys kept by the shared EC_KEY cache */
+#define EC_CACHE_DEFAULT_SIZE 1024
+
+/* Number of signatures a verification thread claims at once */
+#define EC_VERIFY_CHUNK 16
+
+/* Maximum number of signatures checked by one multi-scalar multiplication */
+#define EC_VERIFY_BATCH 32
+/* Size in bits of the random coefficients weighting a batch */
+#define EC_BATCH_RAND_BITS 128
+
 #define PRI_FILENAME "key.pem"
 #define PUB_FILENAME "key_pub.pem"
 
@@ -39,10 +54,207 @@ typedef struct sig_s
 	uint8_t len;
 } sig_t;
 
+/**
+ * struct sha256_engine_s - Single-stream SHA-256 implementation
+ *
+ * @name:      Instruction set used by the engine
+ * @supported: Returns 1 if the engine can run on this CPU, 0 otherwise
+ * @compress:  Runs the compression function on @nb_blocks consecutive
+ *             64-byte blocks, updating @state, or NULL if the engine
+ *             hashes through OpenSSL
+ */
+typedef struct sha256_engine_s
+{
+	char const *name;
+	int (*supported)(void);
+	void (*compress)(uint32_t state[8], uint8_t const *blocks,
+					 size_t nb_blocks);
+} sha256_engine_t;
+
+/**
+ * struct sha256_ctx_s - State of a SHA-256 hash computed incrementally
+ *
+ * Description: A copy of the context resumes the hash from the same point.
+ *
+ * @engine: Engine computing the hash
+ * @state:  OpenSSL state, if @engine has no compression function
+ * @h:      Hash of the complete 64-byte blocks fed so far, otherwise
+ * @block:  Bytes of the last incomplete block
+ * @used:   Number of bytes in @block
+ * @len:    Number of bytes fed so far
+ */
+typedef struct sha256_ctx_s
+{
+	sha256_engine_t const *engine;
+	SHA256_CTX state;
+	uint32_t h[8];
+	uint8_t block[SHA256_CBLOCK];
+	size_t used;
+	uint64_t len;
+} sha256_ctx_t;
+
+/**
+ * struct sha256_mb_engine_s - Multi-buffer SHA-256 implementation
+ *
+ * @name:      Instruction set used by the engine
+ * @lanes:     Number of messages hashed by one call to @hash
+ * @supported: Returns 1 if the engine can run on this CPU, 0 otherwise
+ * @hash:      Hashes exactly @lanes messages of the same length
+ */
+typedef struct sha256_mb_engine_s
+{
+	char const *name;
+	unsigned int lanes;
+	int (*supported)(void);
+	void (*hash)(uint8_t const *const *msgs, size_t len,
+				 uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+} sha256_mb_engine_t;
+
+/**
+ * struct ec_cache_entry_s - Public key decoded by an EC_KEY cache
+ *
+ * @pub:   Public key, used as the cache key
+ * @key:   EC_KEY decoded from @pub, holding one reference owned by the cache
+ * @prev:  Entry used more recently, NULL for the most recently used one
+ * @next:  Entry used less recently, NULL for the least recently used one
+ * @chain: Next entry of the same hash bucket
+ */
+typedef struct ec_cache_entry_s
+{
+	uint8_t pub[EC_PUB_LEN];
+	EC_KEY *key;
+	struct ec_cache_entry_s *prev;
+	struct ec_cache_entry_s *next;
+	struct ec_cache_entry_s *chain;
+} ec_cache_entry_t;
+
+/**
+ * struct ec_cache_s - Bounded LRU cache of EC_KEY decoded from public keys
+ *
+ * Description: Entries are found through a chained hash table, and kept
+ * in a list ordered from the most to the least recently used one. Once
+ * @capacity entries are cached, the least recently used one is evicted.
+ * The cache can be shared by several threads.
+ *
+ * @buckets:    Hash table of @nb_buckets chains of entries
+ * @nb_buckets: Number of buckets, always a power of 2
+ * @head:       Most recently used entry
+ * @tail:       Least recently used entry
+ * @size:       Number of cached entries
+ * @capacity:   Maximum number of cached entries
+ * @hits:       Number of lookups answered from the cache
+ * @misses:     Number of lookups that had to decode the public key
+ * @lock:       Protects all the above
+ */
+typedef struct ec_cache_s
+{
+	ec_cache_entry_t **buckets;
+	size_t nb_buckets;
+	ec_cache_entry_t *head;
+	ec_cache_entry_t *tail;
+	size_t size;
+	size_t capacity;
+	unsigned long hits;
+	unsigned long misses;
+	pthread_mutex_t lock;
+} ec_cache_t;
+
+/**
+ * struct ec_verify_item_s - Signature to verify, along with what it signs
+ *
+ * @pub:    Public key of the signer
+ * @msg:    Points to the @msglen signed bytes
+ * @msglen: Length of @msg
+ * @sig:    Points to the signature to check
+ */
+typedef struct ec_verify_item_s
+{
+	uint8_t pub[EC_PUB_LEN];
+	uint8_t const *msg;
+	size_t msglen;
+	sig_t const *sig;
+} ec_verify_item_t;
+
+/**
+ * struct ec_verify_ctx_s - State shared by the threads verifying signatures
+ *
+ * @items:   Signatures to verify
+ * @nb:      Number of signatures in @items
+ * @next:    Index of the first signature not claimed by a thread yet
+ * @failure: Lowest index of an invalid signature found so far,
+ *           or @nb if none was found
+ * @lock:    Protects @next and @failure
+ */
+typedef struct ec_verify_ctx_s
+{
+	ec_verify_item_t const *items;
+	size_t nb;
+	size_t next;
+	size_t failure;
+	pthread_mutex_t lock;
+} ec_verify_ctx_t;
+
+/**
+ * struct ec_batch_s - Signatures checked together, by one multi-scalar
+ *                     multiplication
+ *
+ * Description: Each signature (r, s) of a message hash e by a key Q is
+ * weighted by a random a, and the batch holds if
+ * sum(a * e / s) * G + sum(a * r / s * Q) - sum(a * R) is the point at
+ * infinity, R being the point of x-coordinate r and even y-coordinate,
+ * as chosen by ec_sign().
+ *
+ * @group:    Curve of the signatures
+ * @ctx:      Scratch numbers
+ * @g_scalar: Scalar of the generator, sum(a * e / s)
+ * @scalars:  Scalar of each point, a * r / s for Q and -a for R
+ * @points:   Public key Q and nonce point R of each signature
+ * @nonces:   Nonce point R of each signature
+ * @keys:     EC_KEY holding each public key, one reference each
+ * @size:     Number of signatures in the batch
+ */
+typedef struct ec_batch_s
+{
+	EC_GROUP *group;
+	BN_CTX *ctx;
+	BIGNUM *g_scalar;
+	BIGNUM *scalars[2 * EC_VERIFY_BATCH];
+	EC_POINT const *points[2 * EC_VERIFY_BATCH];
+	EC_POINT *nonces[EC_VERIFY_BATCH];
+	EC_KEY *keys[EC_VERIFY_BATCH];
+	size_t size;
+} ec_batch_t;
+
 /* sha256.c */
 uint8_t
 *sha256(int8_t const *s, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH]);
 
+/* sha256_ctx.c */
+sha256_ctx_t *sha256_init(sha256_ctx_t *ctx);
+sha256_ctx_t *sha256_init_engine(sha256_ctx_t *ctx,
+								 sha256_engine_t const *engine);
+sha256_ctx_t *sha256_update(sha256_ctx_t *ctx, void const *data, size_t len);
+uint8_t *sha256_final(sha256_ctx_t *ctx, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+/* sha256_engine.c */
+sha256_engine_t const *sha256_engines(void);
+sha256_engine_t const *sha256_engine(void);
+uint8_t *sha256_engine_hash(sha256_engine_t const *engine, uint8_t const *msg,
+							size_t len, uint8_t digest[SHA256_DIGEST_LENGTH]);
+
+/* sha256_selftest.c */
+int sha256_engine_selftest(sha256_engine_t const *engine);
+
+/* sha256_mb.c */
+sha256_mb_engine_t const *sha256_mb_engines(void);
+sha256_mb_engine_t const *sha256_mb_engine(void);
+unsigned int sha256_mb_lanes(void);
+int sha256_mb(int8_t const *const *msgs, size_t len, unsigned int n,
+			  uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+
+/* sha256_mb_selftest.c */
+int sha256_mb_selftest(sha256_mb_engine_t const *engine);
+
 /* ec_create.c */
 EC_KEY *ec_create(void);
 
@@ -52,6 +264,17 @@ uint8_t *ec_to_pub(EC_KEY const *key, uint8_t pub[EC_PUB_LEN]);
 /* ec_from_pub.c */
 EC_KEY *ec_from_pub(uint8_t const pub[EC_PUB_LEN]);
 
+/* ec_cache.c */
+ec_cache_t *ec_cache_create(size_t capacity);
+void ec_cache_destroy(ec_cache_t *cache);
+EC_KEY *ec_cache_get(ec_cache_t *cache, uint8_t const pub[EC_PUB_LEN]);
+
+/* ec_cache_default.c */
+ec_cache_t *ec_cache_default(void);
+EC_KEY *ec_from_pub_cached(uint8_t const pub[EC_PUB_LEN]);
+void ec_cache_stats(ec_cache_t *cache, unsigned long *hits,
+					unsigned long *misses);
+
 /* ec_save.c */
 int ec_save(EC_KEY *key, char const *folder);
 
@@ -66,4 +289,31 @@ uint8_t
 int ec_verify(EC_KEY const *key, uint8_t const *msg, size_t msglen,
 			  sig_t const *sig);
 
+/* ec_verify_parallel.c */
+int ec_verify_parallel(ec_verify_item_t const *items, size_t nb,
+					   unsigned int nthreads, size_t *failure);
+
+/* ec_verify_batch.c */
+int ec_verify_batch(ec_verify_item_t const *items, size_t nb,
+					size_t *failure);
+size_t ec_verify_groups(ec_batch_t *batch, ec_verify_item_t const *items,
+						size_t nb, int *batching);
+
+/* ec_batch.c */
+ec_batch_t *ec_batch_create(void);
+void ec_batch_destroy(ec_batch_t *batch);
+void ec_batch_clear(ec_batch_t *batch);
+int ec_batch_add(ec_batch_t *batch, ec_verify_item_t const *item);
+int ec_batch_check(ec_batch_t *batch);
+
+/* ec_sig.c */
+int ec_sig_decode(sig_t const *sig, BIGNUM const *order, BIGNUM *r,
+				  BIGNUM *s);
+int ec_sig_encode(BIGNUM const *r, BIGNUM const *s, sig_t *sig);
+int ec_sig_scalars(BIGNUM const *order, uint8_t const *msg, size_t msglen,
+				   BIGNUM const *r, BIGNUM const *s, BIGNUM *u1, BIGNUM *u2,
+				   BN_CTX *ctx);
+int ec_sig_normalize(EC_KEY const *key, uint8_t const *msg, size_t msglen,
+					 sig_t *sig);
+
 #endif /* HBLK_CRYPTO_H */
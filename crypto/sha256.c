@@ -9,6 +9,9 @@
  *		   and if digest is NULL,
  *		   do nothing and return NULL.
  * No memory allocations allowed.
+ *
+ * The hash is computed by the engine picked for this CPU, see
+ * sha256_engine().
 */
 uint8_t
 *sha256(int8_t const *s, size_t len, uint8_t digest[SHA256_DIGEST_LENGTH])
@@ -17,5 +20,6 @@ uint8_t
 	if (!s || (digest == NULL))
 		return (NULL);
 
-	return (SHA256((unsigned char *)s, len, digest));
+	return (sha256_engine_hash(sha256_engine(), (uint8_t const *)s, len,
+							   digest));
 }
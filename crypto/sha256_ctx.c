@@ -0,0 +1,118 @@
+#include "sha256_mb.h"
+
+/**
+ * sha256_init - Starts a SHA-256 hash computed incrementally
+ * @ctx: Context to initialize, may have been used for a previous hash
+ *
+ * Description: The hash is computed by the engine picked for this CPU,
+ * see sha256_engine().
+ *
+ * Return: Pointer to ctx, or NULL if ctx is NULL
+*/
+sha256_ctx_t *sha256_init(sha256_ctx_t *ctx)
+{
+	return (sha256_init_engine(ctx, sha256_engine()));
+}
+
+/**
+ * sha256_init_engine - Starts a SHA-256 hash computed incrementally by
+ *						a given engine
+ * @ctx: Context to initialize, may have been used for a previous hash
+ * @engine: Engine computing the hash
+ *
+ * Return: Pointer to ctx, or NULL on failure
+*/
+sha256_ctx_t *sha256_init_engine(sha256_ctx_t *ctx,
+								 sha256_engine_t const *engine)
+{
+	if (!ctx || !engine)
+		return (NULL);
+
+	ctx->engine = engine;
+	ctx->used = 0, ctx->len = 0;
+	if (!engine->compress)
+		return (SHA256_Init(&(ctx->state)) ? ctx : NULL);
+
+	memcpy(ctx->h, sha256_mb_h0, sizeof(ctx->h));
+	return (ctx);
+}
+
+/**
+ * sha256_update - Feeds bytes to a SHA-256 hash computed incrementally
+ * @ctx: Context started by sha256_init()
+ * @data: Bytes to hash
+ * @len: Number of bytes to hash in data
+ *
+ * Description: The bytes are hashed in place, as if they were appended to
+ * those fed by the previous calls, so they never need to be concatenated.
+ * Only the bytes of an incomplete block are kept for the next call.
+ *
+ * Return: Pointer to ctx, or NULL on failure
+*/
+sha256_ctx_t *sha256_update(sha256_ctx_t *ctx, void const *data, size_t len)
+{
+	uint8_t const *bytes = data;
+	size_t n;
+
+	if (!ctx || !ctx->engine || (!data && len))
+		return (NULL);
+	if (!ctx->engine->compress)
+		return (SHA256_Update(&(ctx->state), data, len) ? ctx : NULL);
+
+	ctx->len += len;
+	if (ctx->used)
+	{
+		n = SHA256_CBLOCK - ctx->used < len ? SHA256_CBLOCK - ctx->used : len;
+		memcpy(ctx->block + ctx->used, bytes, n);
+		ctx->used += n, bytes += n, len -= n;
+		if (ctx->used < SHA256_CBLOCK)
+			return (ctx);
+		ctx->engine->compress(ctx->h, ctx->block, 1);
+		ctx->used = 0;
+	}
+	if (len >= SHA256_CBLOCK)
+	{
+		ctx->engine->compress(ctx->h, bytes, len / SHA256_CBLOCK);
+		bytes += len - len % SHA256_CBLOCK, len %= SHA256_CBLOCK;
+	}
+	memcpy(ctx->block, bytes, len);
+	ctx->used = len;
+
+	return (ctx);
+}
+
+/**
+ * sha256_final - Completes a SHA-256 hash computed incrementally
+ * @ctx: Context started by sha256_init(), to be started again before
+ *		 being reused
+ * @digest: Array receiving the resulting hash
+ *
+ * Return: Pointer to digest, or NULL on failure
+*/
+uint8_t *sha256_final(sha256_ctx_t *ctx, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+	uint8_t tail[SHA256_MB_TAIL_LEN];
+	size_t nb_tail, k;
+	int i;
+
+	if (!ctx || !ctx->engine || digest == NULL)
+		return (NULL);
+	if (!ctx->engine->compress)
+		return (SHA256_Final(digest, &(ctx->state)) ? digest : NULL);
+
+	/* Pad the buffered bytes, then overwrite the length with the total */
+	nb_tail = sha256_mb_pad(ctx->block, ctx->used, tail);
+	for (i = 0; i < 8; i++)
+		tail[nb_tail * SHA256_CBLOCK - 1 - i] = (uint8_t)((ctx->len * 8) >>
+															(8 * i));
+	ctx->engine->compress(ctx->h, tail, nb_tail);
+	for (k = 0; k < 8; k++)
+	{
+		digest[4 * k] = (uint8_t)(ctx->h[k] >> 24);
+		digest[4 * k + 1] = (uint8_t)(ctx->h[k] >> 16);
+		digest[4 * k + 2] = (uint8_t)(ctx->h[k] >> 8);
+		digest[4 * k + 3] = (uint8_t)ctx->h[k];
+	}
+
+	return (digest);
+}
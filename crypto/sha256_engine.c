@@ -0,0 +1,101 @@
+#include "sha256_mb.h"
+
+/* Engine chosen by sha256_select(), set only once */
+static sha256_engine_t const *selected_engine;
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+
+/**
+ * sha256_engines - Lists the single-stream engines, fastest first
+ *
+ * Return: Array of engines, terminated by an engine with a NULL name
+*/
+sha256_engine_t const *sha256_engines(void)
+{
+	static sha256_engine_t const engines[] = {
+		{"shani", sha256_ni_supported, sha256_ni_compress},
+		{"openssl", sha256_openssl_supported, NULL},
+		{NULL, NULL, NULL}
+	};
+
+	return (engines);
+}
+
+/**
+ * sha256_select - Picks the fastest engine supported by the CPU that also
+ *				   passes the known-answer test
+*/
+static void sha256_select(void)
+{
+	sha256_engine_t const *engines = sha256_engines();
+	int i;
+
+	for (i = 0; engines[i].name; i++)
+	{
+		if (engines[i].supported() && sha256_engine_selftest(&engines[i]))
+		{
+			selected_engine = &engines[i];
+			return;
+		}
+	}
+}
+
+/**
+ * sha256_engine - Gets the single-stream engine used on this machine
+ *
+ * Return: Pointer to the engine, the OpenSSL one being the last resort
+*/
+sha256_engine_t const *sha256_engine(void)
+{
+	pthread_once(&select_once, sha256_select);
+	return (selected_engine);
+}
+
+/**
+ * sha256_engine_hash - Computes the hash of a message with a given engine
+ * @engine: Pointer to the engine
+ * @msg: Message to hash
+ * @len: Length of msg in bytes
+ * @digest: Array receiving the resulting hash
+ *
+ * Description: The complete blocks are compressed straight from msg, only
+ * the padded tail is copied.
+ *
+ * Return: Pointer to digest, or NULL on failure
+*/
+uint8_t *sha256_engine_hash(sha256_engine_t const *engine, uint8_t const *msg,
+							size_t len, uint8_t digest[SHA256_DIGEST_LENGTH])
+{
+	uint8_t tail[SHA256_MB_TAIL_LEN];
+	uint32_t h[8];
+	size_t nb_tail, k;
+
+	if (!engine || (!msg && len) || digest == NULL)
+		return (NULL);
+	if (!engine->compress)
+		return (SHA256(msg, len, digest));
+
+	memcpy(h, sha256_mb_h0, sizeof(h));
+	nb_tail = sha256_mb_pad(msg, len, tail);
+	if (len >= SHA256_CBLOCK)
+		engine->compress(h, msg, len / SHA256_CBLOCK);
+	engine->compress(h, tail, nb_tail);
+	for (k = 0; k < 8; k++)
+	{
+		digest[4 * k] = (uint8_t)(h[k] >> 24);
+		digest[4 * k + 1] = (uint8_t)(h[k] >> 16);
+		digest[4 * k + 2] = (uint8_t)(h[k] >> 8);
+		digest[4 * k + 3] = (uint8_t)h[k];
+	}
+
+	return (digest);
+}
+
+/**
+ * sha256_openssl_supported - The OpenSSL engine runs everywhere
+ *
+ * Return: 1
+*/
+int sha256_openssl_supported(void)
+{
+	return (1);
+}
@@ -0,0 +1,109 @@
+#include "sha256_mb.h"
+
+/* Engine chosen by sha256_mb_select(), set only once */
+static sha256_mb_engine_t const *selected_engine;
+static pthread_once_t select_once = PTHREAD_ONCE_INIT;
+
+/**
+ * sha256_mb_engines - Lists the multi-buffer engines, widest first, the
+ *					   scalar one last
+ *
+ * Return: Array of engines, terminated by an engine with a NULL name
+*/
+sha256_mb_engine_t const *sha256_mb_engines(void)
+{
+	static sha256_mb_engine_t const engines[] = {
+		{"avx512", 16, sha256_mb_avx512_supported, sha256_mb_avx512_hash},
+		{"avx2", 8, sha256_mb_avx2_supported, sha256_mb_avx2_hash},
+		{"sse4", 4, sha256_mb_sse4_supported, sha256_mb_sse4_hash},
+		{"scalar", 1, sha256_mb_scalar_supported, sha256_mb_scalar_hash},
+		{NULL, 0, NULL, NULL}
+	};
+
+	return (engines);
+}
+
+/**
+ * sha256_mb_select - Picks the engine hashing the most messages per second
+ *					  among those supported by the CPU that also pass the
+ *					  self-test
+ *
+ * Description: A wider engine is not always faster: the scalar one may
+ * use SHA instructions that beat several lanes of general purpose vector
+ * instructions. Each engine is timed once, on this machine.
+*/
+static void sha256_mb_select(void)
+{
+	sha256_mb_engine_t const *engines = sha256_mb_engines();
+	double rate, best = 0;
+	int i;
+
+	for (i = 0; engines[i].name; i++)
+	{
+		if (!engines[i].supported() || !sha256_mb_selftest(&engines[i]))
+			continue;
+		rate = sha256_mb_calibrate(&engines[i]);
+		if (!selected_engine || rate > best)
+			selected_engine = &engines[i], best = rate;
+	}
+
+	/* The scalar engine, last of the list, cannot fail */
+	if (!selected_engine)
+		selected_engine = &engines[i - 1];
+}
+
+/**
+ * sha256_mb_engine - Gets the multi-buffer engine used on this machine
+ *
+ * Return: Pointer to the engine, the scalar one being the last resort
+*/
+sha256_mb_engine_t const *sha256_mb_engine(void)
+{
+	pthread_once(&select_once, sha256_mb_select);
+	return (selected_engine);
+}
+
+/**
+ * sha256_mb_lanes - Gets the number of messages hashed at once
+ *
+ * Return: Number of lanes of the engine used on this machine
+*/
+unsigned int sha256_mb_lanes(void)
+{
+	return (sha256_mb_engine()->lanes);
+}
+
+/**
+ * sha256_mb - Computes the hashes of several messages of the same length
+ * @msgs: Array of n messages
+ * @len: Length of each message, in bytes
+ * @n: Number of messages
+ * @digests: Array of n buffers receiving the digests
+ *
+ * Messages are hashed by groups of sha256_mb_lanes(), the last group being
+ * completed by repeating its first message.
+ *
+ * Return: 0 on success, -1 on failure
+*/
+int sha256_mb(int8_t const *const *msgs, size_t len, unsigned int n,
+			  uint8_t (*digests)[SHA256_DIGEST_LENGTH])
+{
+	sha256_mb_engine_t const *engine = sha256_mb_engine();
+	uint8_t const *group[SHA256_MB_MAX_LANES];
+	uint8_t out[SHA256_MB_MAX_LANES][SHA256_DIGEST_LENGTH];
+	unsigned int i, l, nb;
+
+	if (!msgs || !digests)
+		return (-1);
+
+	for (i = 0; i < n; i += nb)
+	{
+		nb = n - i < engine->lanes ? n - i : engine->lanes;
+		for (l = 0; l < engine->lanes; l++)
+			group[l] = (uint8_t const *)msgs[l < nb ? i + l : i];
+		engine->hash(group, len, out);
+		memcpy(digests + i, out, nb * SHA256_DIGEST_LENGTH);
+	}
+
+	return (0);
+}
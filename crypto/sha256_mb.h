@@ -0,0 +1,65 @@
+#ifndef SHA256_MB_H
+#define SHA256_MB_H
+
+#include <pthread.h>
+#include "hblk_crypto.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define SHA256_MB_X86 1
+#else
+#define SHA256_MB_X86 0
+#endif
+
+/* A padded message tail never exceeds two 64-byte blocks */
+#define SHA256_MB_TAIL_LEN (2 * SHA256_CBLOCK)
+
+/* Messages of a Block header's length, hashed to time each engine */
+#define SHA256_MB_CALIBRATION_LEN 88
+#define SHA256_MB_CALIBRATION_ROUNDS 512
+#define SHA256_MB_CALIBRATION_RUNS 3
+
+/* SHA-256 functions (FIPS 180-4, section 4.1.2), work on vectors too */
+#define MB_ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+#define MB_CH(x, y, z) (((x) & (y)) ^ (~(x) & (z)))
+#define MB_MAJ(x, y, z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define MB_BSIG0(x) (MB_ROTR(x, 2) ^ MB_ROTR(x, 13) ^ MB_ROTR(x, 22))
+#define MB_BSIG1(x) (MB_ROTR(x, 6) ^ MB_ROTR(x, 11) ^ MB_ROTR(x, 25))
+#define MB_SSIG0(x) (MB_ROTR(x, 7) ^ MB_ROTR(x, 18) ^ ((x) >> 3))
+#define MB_SSIG1(x) (MB_ROTR(x, 17) ^ MB_ROTR(x, 19) ^ ((x) >> 10))
+
+/* sha256_mb_common.c */
+extern uint32_t const sha256_mb_k[64];
+extern uint32_t const sha256_mb_h0[8];
+size_t sha256_mb_pad(uint8_t const *msg, size_t len,
+					 uint8_t tail[SHA256_MB_TAIL_LEN]);
+int sha256_mb_scalar_supported(void);
+void sha256_mb_scalar_hash(uint8_t const *const *msgs, size_t len,
+						   uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+
+/* sha256_mb_selftest.c */
+double sha256_mb_calibrate(sha256_mb_engine_t const *engine);
+
+/* sha256_ni.c */
+int sha256_ni_supported(void);
+void sha256_ni_compress(uint32_t state[8], uint8_t const *blocks,
+						size_t nb_blocks);
+
+/* sha256_engine.c */
+int sha256_openssl_supported(void);
+
+/* sha256_mb_sse4.c */
+int sha256_mb_sse4_supported(void);
+void sha256_mb_sse4_hash(uint8_t const *const *msgs, size_t len,
+						 uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+
+/* sha256_mb_avx2.c */
+int sha256_mb_avx2_supported(void);
+void sha256_mb_avx2_hash(uint8_t const *const *msgs, size_t len,
+						 uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+
+/* sha256_mb_avx512.c */
+int sha256_mb_avx512_supported(void);
+void sha256_mb_avx512_hash(uint8_t const *const *msgs, size_t len,
+						   uint8_t (*digests)[SHA256_DIGEST_LENGTH]);
+
+#endif /* SHA256_MB_H */
@@ -0,0 +1,74 @@
+#include "sha256_mb.h"
+
+/* Round constants (FIPS 180-4, section 4.2.2) */
+uint32_t const sha256_mb_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* Initial hash value (FIPS 180-4, section 5.3.3) */
+uint32_t const sha256_mb_h0[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+/**
+ * sha256_mb_pad - Builds the padded tail of a message
+ * @msg: Message to hash
+ * @len: Length of msg in bytes
+ * @tail: Buffer receiving the bytes following the last full 64-byte block
+ *		  of msg, the 0x80 marker, zeros and the length in bits
+ *
+ * Return: Number of 64-byte blocks written in tail (1 or 2)
+*/
+size_t sha256_mb_pad(uint8_t const *msg, size_t len,
+					 uint8_t tail[SHA256_MB_TAIL_LEN])
+{
+	size_t rest = len % SHA256_CBLOCK, nb_blocks, i;
+	uint64_t bits = (uint64_t)len * 8;
+
+	nb_blocks = rest < SHA256_CBLOCK - 8 ? 1 : 2;
+	memset(tail, 0, SHA256_MB_TAIL_LEN);
+	memcpy(tail, msg + (len - rest), rest);
+	tail[rest] = 0x80;
+	for (i = 0; i < 8; i++)
+		tail[nb_blocks * SHA256_CBLOCK - 1 - i] = (uint8_t)(bits >> (8 * i));
+
+	return (nb_blocks);
+}
+
+/**
+ * sha256_mb_scalar_supported - The scalar engine runs everywhere
+ *
+ * Return: 1
+*/
+int sha256_mb_scalar_supported(void)
+{
+	return (1);
+}
+
+/**
+ * sha256_mb_scalar_hash - Scalar engine, hashes one message through OpenSSL
+ * @msgs: Array of one message
+ * @len: Length of the message in bytes
+ * @digests: Array of one buffer receiving the digest
+*/
+void sha256_mb_scalar_hash(uint8_t const *const *msgs, size_t len,
+						   uint8_t (*digests)[SHA256_DIGEST_LENGTH])
+{
+	sha256((int8_t const *)msgs[0], len, digests[0]);
+}
@@ -0,0 +1,105 @@
+/*
+ * Multi-buffer SHA-256 kernel, compiled once per instruction set.
+ * Each lane of a vector holds the state of a different message.
+ *
+ * The including file must define:
+ *	MB_LANES:   Number of 32-bit lanes in a vector
+ *	MB_TARGET:  Instruction set given to the compiler, e.g. "avx2"
+ *	MB_NAME(x): Prefixes x with the name of the engine
+ */
+
+#define MB_VEC MB_NAME(vec_t)
+
+typedef uint32_t MB_VEC __attribute__((vector_size(MB_LANES * 4)));
+
+/**
+ * load - Loads one 64-byte block of every lane, as big-endian words
+ * @w: Message schedule to fill in, one vector per word
+ * @blocks: Pointer to the current block of each lane
+ */
+__attribute__((target(MB_TARGET)))
+static void MB_NAME(load)(MB_VEC w[16], uint8_t const *blocks[MB_LANES])
+{
+	unsigned int j, l;
+	uint8_t const *p;
+
+	for (j = 0; j < 16; j++)
+	{
+		for (l = 0; l < MB_LANES; l++)
+		{
+			p = blocks[l] + 4 * j;
+			w[j][l] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+					  ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+		}
+	}
+}
+
+/**
+ * compress - Runs the 64 rounds of the compression function on all lanes
+ * @s: Hash state of every lane, updated in place
+ * @w: Message schedule loaded by load(), used as a rolling window
+ */
+__attribute__((target(MB_TARGET)))
+static void MB_NAME(compress)(MB_VEC s[8], MB_VEC w[16])
+{
+	MB_VEC a, b, c, d, e, f, g, h, t1, t2;
+	unsigned int i;
+
+	a = s[0], b = s[1], c = s[2], d = s[3];
+	e = s[4], f = s[5], g = s[6], h = s[7];
+	for (i = 0; i < 64; i++)
+	{
+		if (i >= 16)
+			w[i & 15] += MB_SSIG1(w[(i - 2) & 15]) + w[(i - 7) & 15] +
+						 MB_SSIG0(w[(i - 15) & 15]);
+		t1 = h + MB_BSIG1(e) + MB_CH(e, f, g) + sha256_mb_k[i] + w[i & 15];
+		t2 = MB_BSIG0(a) + MB_MAJ(a, b, c);
+		h = g, g = f, f = e, e = d + t1;
+		d = c, c = b, b = a, a = t1 + t2;
+	}
+	s[0] += a, s[1] += b, s[2] += c, s[3] += d;
+	s[4] += e, s[5] += f, s[6] += g, s[7] += h;
+}
+
+/**
+ * hash - Hashes MB_LANES messages of the same length at once
+ * @msgs: Array of MB_LANES messages
+ * @len: Length of each message, in bytes
+ * @digests: Array of MB_LANES buffers receiving the digests
+ */
+__attribute__((target(MB_TARGET)))
+void MB_NAME(hash)(uint8_t const *const *msgs, size_t len,
+				   uint8_t (*digests)[SHA256_DIGEST_LENGTH])
+{
+	MB_VEC s[8], w[16];
+	uint8_t tails[MB_LANES][SHA256_MB_TAIL_LEN];
+	uint8_t const *blocks[MB_LANES];
+	size_t full = len / SHA256_CBLOCK, nb_blocks = full, b;
+	unsigned int k, l;
+
+	for (l = 0; l < MB_LANES; l++)
+		nb_blocks = full + sha256_mb_pad(msgs[l], len, tails[l]);
+	for (k = 0; k < 8; k++)
+		for (l = 0; l < MB_LANES; l++)
+			s[k][l] = sha256_mb_h0[k];
+
+	for (b = 0; b < nb_blocks; b++)
+	{
+		for (l = 0; l < MB_LANES; l++)
+			blocks[l] = b < full ? msgs[l] + b * SHA256_CBLOCK :
+					    tails[l] + (b - full) * SHA256_CBLOCK;
+		MB_NAME(load)(w, blocks);
+		MB_NAME(compress)(s, w);
+	}
+
+	for (l = 0; l < MB_LANES; l++)
+	{
+		for (k = 0; k < 8; k++)
+		{
+			digests[l][4 * k] = (uint8_t)(s[k][l] >> 24);
+			digests[l][4 * k + 1] = (uint8_t)(s[k][l] >> 16);
+			digests[l][4 * k + 2] = (uint8_t)(s[k][l] >> 8);
+			digests[l][4 * k + 3] = (uint8_t)s[k][l];
+		}
+	}
+}
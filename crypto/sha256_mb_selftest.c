@@ -0,0 +1,96 @@
+#include <time.h>
+
+#include "sha256_mb.h"
+
+/* Lengths covering empty, one and two padding blocks, and long messages */
+static size_t const selftest_lengths[] = {
+	0, 1, 3, 32, 55, 56, 63, 64, 65, 69, 88, 111, 119, 120, 127, 128, 129,
+	200, 1024
+};
+
+#define SELFTEST_MAX_LEN 1024
+
+/**
+ * sha256_mb_selftest - Checks an engine against the OpenSSL implementation
+ * @engine: Pointer to the engine to check
+ *
+ * Every lane hashes a different message, for several lengths around
+ * the padding boundaries.
+ *
+ * Return: 1 if every digest matches the OpenSSL one, 0 otherwise
+*/
+int sha256_mb_selftest(sha256_mb_engine_t const *engine)
+{
+	uint8_t msgs[SHA256_MB_MAX_LANES][SELFTEST_MAX_LEN];
+	uint8_t const *ptrs[SHA256_MB_MAX_LANES];
+	uint8_t digests[SHA256_MB_MAX_LANES][SHA256_DIGEST_LENGTH];
+	uint8_t expected[SHA256_DIGEST_LENGTH];
+	size_t t, i, len;
+	unsigned int l;
+
+	if (!engine || !engine->hash || engine->lanes > SHA256_MB_MAX_LANES)
+		return (0);
+
+	for (t = 0; t < sizeof(selftest_lengths) / sizeof(*selftest_lengths); t++)
+	{
+		len = selftest_lengths[t];
+		for (l = 0; l < engine->lanes; l++)
+		{
+			for (i = 0; i < len; i++)
+				msgs[l][i] = (uint8_t)(i * 31 + l * 7 + len);
+			ptrs[l] = msgs[l];
+		}
+		engine->hash(ptrs, len, digests);
+		for (l = 0; l < engine->lanes; l++)
+		{
+			SHA256(msgs[l], len, expected);
+			if (memcmp(expected, digests[l], SHA256_DIGEST_LENGTH) != 0)
+				return (0);
+		}
+	}
+
+	return (1);
+}
+
+/**
+ * sha256_mb_calibrate - Measures the throughput of an engine
+ * @engine: Pointer to the engine to measure
+ *
+ * Description: The time is the CPU time of the calling thread, so that
+ * other threads hashing at the same time do not count. The best of
+ * SHA256_MB_CALIBRATION_RUNS runs is kept.
+ *
+ * Return: Number of messages hashed per second, 0 if it cannot be measured
+*/
+double sha256_mb_calibrate(sha256_mb_engine_t const *engine)
+{
+	uint8_t msgs[SHA256_MB_MAX_LANES][SHA256_MB_CALIBRATION_LEN] = {{0}};
+	uint8_t const *ptrs[SHA256_MB_MAX_LANES];
+	uint8_t digests[SHA256_MB_MAX_LANES][SHA256_DIGEST_LENGTH];
+	struct timespec start, end;
+	double elapsed, best = 0;
+	unsigned int l, i, run;
+
+	for (l = 0; l < engine->lanes; l++)
+		ptrs[l] = msgs[l], msgs[l][0] = (uint8_t)l;
+	for (run = 0; run < SHA256_MB_CALIBRATION_RUNS; run++)
+	{
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start) != 0)
+			return (0);
+		for (i = 0; i < SHA256_MB_CALIBRATION_ROUNDS; i++)
+		{
+			for (l = 0; l < engine->lanes; l++)
+				memcpy(msgs[l] + 1, &i, sizeof(i));
+			engine->hash(ptrs, SHA256_MB_CALIBRATION_LEN, digests);
+		}
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end) != 0)
+			return (0);
+		elapsed = (double)(end.tv_sec - start.tv_sec) +
+				  (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+		if (elapsed > 0 &&
+			SHA256_MB_CALIBRATION_ROUNDS * engine->lanes / elapsed > best)
+			best = SHA256_MB_CALIBRATION_ROUNDS * engine->lanes / elapsed;
+	}
+
+	return (best);
+}
@@ -0,0 +1,44 @@
+#include "sha256_mb.h"
+
+#if SHA256_MB_X86
+
+#define MB_LANES 4
+#define MB_TARGET "sse4.1"
+#define MB_NAME(x) sha256_mb_sse4_##x
+#include "sha256_mb_kernel.h"
+
+/**
+ * sha256_mb_sse4_supported - Checks if the CPU and the OS support SSE4.1
+ *
+ * Return: 1 if supported, 0 otherwise
+*/
+int sha256_mb_sse4_supported(void)
+{
+	return (__builtin_cpu_supports("sse4.1") ? 1 : 0);
+}
+
+#else /* !SHA256_MB_X86 */
+
+/**
+ * sha256_mb_sse4_supported - SSE4.1 is only available on x86
+ *
+ * Return: 0
+*/
+int sha256_mb_sse4_supported(void)
+{
+	return (0);
+}
+
+/**
+ * sha256_mb_sse4_hash - Never called, the engine is not supported
+ * @msgs: Unused
+ * @len: Unused
+ * @digests: Unused
+*/
+void sha256_mb_sse4_hash(uint8_t const *const *msgs, size_t len,
+						uint8_t (*digests)[SHA256_DIGEST_LENGTH])
+{
+	(void)msgs, (void)len, (void)digests;
+}
+
+#endif /* SHA256_MB_X86 */
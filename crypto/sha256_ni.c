@@ -0,0 +1,107 @@
+#include "sha256_mb.h"
+
+#if SHA256_MB_X86
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/**
+ * sha256_ni_supported - Checks if the CPU supports the SHA extensions,
+ *						 along with the SSSE3 and SSE4.1 instructions used
+ *						 to shuffle the state
+ *
+ * Return: 1 if supported, 0 otherwise
+*/
+int sha256_ni_supported(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) ||
+		!(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1))
+		return (0);
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+		return (0);
+
+	return ((ebx & bit_SHA) ? 1 : 0);
+}
+
+/**
+ * sha256_ni_compress - Runs the compression function on consecutive
+ *						64-byte blocks with the SHA extensions
+ * @state: Hash state, updated in place
+ * @blocks: Blocks to compress
+ * @nb_blocks: Number of blocks
+ *
+ * Description: The SHA extensions work on the state split in two vectors,
+ * ABEF and CDGH. Each sha256rnds2 runs two rounds, and sha256msg1 and
+ * sha256msg2 extend the message schedule four words at a time.
+*/
+__attribute__((target("sha,sse4.1")))
+void sha256_ni_compress(uint32_t state[8], uint8_t const *blocks,
+						size_t nb_blocks)
+{
+	__m128i abef, cdgh, abef_save, cdgh_save, tmp, msg, w[4];
+	__m128i const mask = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+									   4, 5, 6, 7, 0, 1, 2, 3);
+	unsigned int t;
+
+	tmp = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const *)state), 0xB1);
+	cdgh = _mm_shuffle_epi32(_mm_loadu_si128((__m128i const *)(state + 4)),
+							 0x1B);
+	abef = _mm_alignr_epi8(tmp, cdgh, 8);
+	cdgh = _mm_blend_epi16(cdgh, tmp, 0xF0);
+
+	for (; nb_blocks > 0; nb_blocks--, blocks += SHA256_CBLOCK)
+	{
+		abef_save = abef, cdgh_save = cdgh;
+		for (t = 0; t < 16; t++)
+		{
+			if (t < 4)
+				w[t] = _mm_shuffle_epi8(_mm_loadu_si128(
+					(__m128i const *)(blocks + 16 * t)), mask);
+			else
+				w[t & 3] = _mm_sha256msg2_epu32(_mm_add_epi32(
+					_mm_sha256msg1_epu32(w[t & 3], w[(t + 1) & 3]),
+					_mm_alignr_epi8(w[(t + 3) & 3], w[(t + 2) & 3], 4)),
+					w[(t + 3) & 3]);
+			msg = _mm_add_epi32(w[t & 3], _mm_loadu_si128(
+				(__m128i const *)(sha256_mb_k + 4 * t)));
+			cdgh = _mm_sha256rnds2_epu32(cdgh, abef, msg);
+			abef = _mm_sha256rnds2_epu32(abef, cdgh,
+										 _mm_shuffle_epi32(msg, 0x0E));
+		}
+		abef = _mm_add_epi32(abef, abef_save);
+		cdgh = _mm_add_epi32(cdgh, cdgh_save);
+	}
+
+	tmp = _mm_shuffle_epi32(abef, 0x1B);
+	cdgh = _mm_shuffle_epi32(cdgh, 0xB1);
+	_mm_storeu_si128((__m128i *)state, _mm_blend_epi16(tmp, cdgh, 0xF0));
+	_mm_storeu_si128((__m128i *)(state + 4), _mm_alignr_epi8(cdgh, tmp, 8));
+}
+
+#else /* !SHA256_MB_X86 */
+
+/**
+ * sha256_ni_supported - The SHA extensions are only available on x86
+ *
+ * Return: 0
+*/
+int sha256_ni_supported(void)
+{
+	return (0);
+}
+
+/**
+ * sha256_ni_compress - Never called, the engine is not supported
+ * @state: Unused
+ * @blocks: Unused
+ * @nb_blocks: Unused
+*/
+void sha256_ni_compress(uint32_t state[8], uint8_t const *blocks,
+						size_t nb_blocks)
+{
+	(void)state, (void)blocks, (void)nb_blocks;
+}
+
+#endif /* SHA256_MB_X86 */
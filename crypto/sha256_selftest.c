@@ -0,0 +1,124 @@
+#include "sha256_mb.h"
+
+/* Known answers (FIPS 180-4 examples) */
+static char const *const selftest_kat[][2] = {
+	{"", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"},
+	{"abc",
+	 "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"},
+	{"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+	 "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"},
+	{"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+	 "ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+	 "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1"}
+};
+
+/* Lengths covering empty, one and two padding blocks, and long messages */
+static size_t const selftest_lengths[] = {
+	0, 1, 3, 32, 55, 56, 63, 64, 65, 69, 88, 111, 119, 120, 127, 128, 129,
+	200, 1024
+};
+
+/* Points a message is split at when fed to a context in two parts */
+static size_t const selftest_splits[] = {0, 1, 55, 63, 64, 65, 119, 128};
+
+#define SELFTEST_MAX_LEN 1024
+
+/* Defined after */
+uint8_t selftest_hex(char const *hex);
+int selftest_digest(sha256_engine_t const *engine, uint8_t const *msg,
+					size_t len, uint8_t const expected[SHA256_DIGEST_LENGTH]);
+
+/**
+ * sha256_engine_selftest - Checks a single-stream engine against known
+ *							answers and against the OpenSSL implementation
+ * @engine: Pointer to the engine to check
+ *
+ * Description: Each message is hashed at once, then fed to a context in
+ * two parts, split around the block boundaries.
+ *
+ * Return: 1 if every digest matches, 0 otherwise
+*/
+int sha256_engine_selftest(sha256_engine_t const *engine)
+{
+	uint8_t msg[SELFTEST_MAX_LEN], expected[SHA256_DIGEST_LENGTH];
+	size_t t, i, len;
+
+	if (!engine)
+		return (0);
+
+	for (t = 0; t < sizeof(selftest_kat) / sizeof(*selftest_kat); t++)
+	{
+		for (i = 0; i < SHA256_DIGEST_LENGTH; i++)
+			expected[i] = selftest_hex(selftest_kat[t][1] + 2 * i);
+		if (!selftest_digest(engine, (uint8_t const *)selftest_kat[t][0],
+							 strlen(selftest_kat[t][0]), expected))
+			return (0);
+	}
+
+	for (t = 0; t < sizeof(selftest_lengths) / sizeof(*selftest_lengths); t++)
+	{
+		len = selftest_lengths[t];
+		for (i = 0; i < len; i++)
+			msg[i] = (uint8_t)(i * 31 + len);
+		SHA256(msg, len, expected);
+		if (!selftest_digest(engine, msg, len, expected))
+			return (0);
+	}
+
+	return (1);
+}
+
+/**
+ * selftest_digest - Checks the hashes of a message computed by an engine
+ * @engine: Pointer to the engine to check
+ * @msg: Message to hash
+ * @len: Length of msg in bytes
+ * @expected: Expected digest
+ *
+ * Return: 1 if every digest matches expected, 0 otherwise
+*/
+int selftest_digest(sha256_engine_t const *engine, uint8_t const *msg,
+					size_t len, uint8_t const expected[SHA256_DIGEST_LENGTH])
+{
+	uint8_t digest[SHA256_DIGEST_LENGTH];
+	sha256_ctx_t ctx;
+	size_t s, split;
+
+	if (!sha256_engine_hash(engine, msg, len, digest) ||
+		memcmp(digest, expected, SHA256_DIGEST_LENGTH))
+		return (0);
+
+	for (s = 0; s <= sizeof(selftest_splits) / sizeof(*selftest_splits); s++)
+	{
+		split = s < sizeof(selftest_splits) / sizeof(*selftest_splits) ?
+				selftest_splits[s] : len / 2;
+		if (split > len)
+			continue;
+		sha256_init_engine(&ctx, engine);
+		sha256_update(&ctx, msg, split);
+		sha256_update(&ctx, msg + split, len - split);
+		if (!sha256_final(&ctx, digest) ||
+			memcmp(digest, expected, SHA256_DIGEST_LENGTH))
+			return (0);
+	}
+
+	return (1);
+}
+
+/**
+ * selftest_hex - Decodes a byte written as two hexadecimal digits
+ * @hex: Two lowercase hexadecimal digits
+ *
+ * Return: Decoded byte
+*/
+uint8_t selftest_hex(char const *hex)
+{
+	uint8_t byte = 0;
+	int i;
+
+	for (i = 0; i < 2; i++)
+		byte = (uint8_t)(byte << 4 | (hex[i] <= '9' ? hex[i] - '0' :
+									  hex[i] - 'a' + 10));
+
+	return (byte);
+}
@@ -0,0 +1,59 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "hblk_crypto.h"
+
+#define NB_KEYS 5
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	int const order[] = {0, 1, 2, 0, 3, 0, 1};
+	uint8_t pubs[NB_KEYS][EC_PUB_LEN], pub[EC_PUB_LEN];
+	unsigned long hits, misses;
+	ec_cache_t *cache;
+	EC_KEY *key;
+	int i, ok;
+
+	for (i = 0; i < NB_KEYS; i++)
+	{
+		key = ec_create();
+		ec_to_pub(key, pubs[i]);
+		EC_KEY_free(key);
+	}
+
+	/* Room for 3 keys only */
+	cache = ec_cache_create(3);
+	if (!cache)
+	{
+		fprintf(stderr, "ec_cache_create() failed\n");
+		return (EXIT_FAILURE);
+	}
+
+	/* 0, 1, 2 are decoded, 0 is used again, 3 evicts 1, 1 evicts 2 */
+	for (i = 0; i < 7; i++)
+	{
+		key = ec_cache_get(cache, pubs[order[i]]);
+		ok = key && ec_to_pub(key, pub) && EC_KEY_check_key(key);
+		printf("Key %d: %s\n", order[i], ok ? "OK" : "KO");
+		EC_KEY_free(key);
+	}
+
+	ec_cache_stats(cache, &hits, &misses);
+	printf("Cached: %lu, hits: %lu, misses: %lu\n", cache->size, hits, misses);
+	ec_cache_destroy(cache);
+
+	/* Shared cache */
+	key = ec_from_pub_cached(pubs[4]);
+	EC_KEY_free(key);
+	key = ec_from_pub_cached(pubs[4]);
+	EC_KEY_free(key);
+	ec_cache_stats(NULL, &hits, &misses);
+	printf("Shared cache hits: %lu, misses: %lu\n", hits, misses);
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,115 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "hblk_crypto.h"
+
+#define NB_KEYS 10
+#define NB_SIGS 100
+
+/**
+ * _print_result - Verifies signatures in a batch and prints the result
+ * @label: What is verified
+ * @items: Signatures to verify
+ * @nb: Number of signatures in items
+ */
+static void _print_result(char const *label, ec_verify_item_t const *items,
+						  size_t nb)
+{
+	size_t failure;
+	int valid;
+
+	valid = ec_verify_batch(items, nb, &failure);
+	printf("%s: valid %d, failure at %lu\n", label, valid,
+		   (unsigned long)failure);
+}
+
+/**
+ * _bench - Compares ec_verify() and ec_verify_batch()
+ * @items: Signatures to verify
+ * @nb: Number of signatures in items
+ */
+static void _bench(ec_verify_item_t const *items, size_t nb)
+{
+	clock_t start;
+	double one_by_one, batch;
+	EC_KEY *key;
+	size_t i;
+
+	start = clock();
+	for (i = 0; i < nb; i++)
+	{
+		key = ec_from_pub_cached(items[i].pub);
+		ec_verify(key, items[i].msg, items[i].msglen, items[i].sig);
+		EC_KEY_free(key);
+	}
+	one_by_one = nb / ((double)(clock() - start) / CLOCKS_PER_SEC);
+
+	start = clock();
+	ec_verify_batch(items, nb, NULL);
+	batch = nb / ((double)(clock() - start) / CLOCKS_PER_SEC);
+
+	fprintf(stderr, "ec_verify: %.0f sigs/s, ec_verify_batch: %.0f sigs/s\n",
+			one_by_one, batch);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	ec_verify_item_t items[NB_SIGS];
+	sig_t sigs[NB_SIGS];
+	uint8_t msgs[NB_SIGS][SHA256_DIGEST_LENGTH];
+	EC_KEY *keys[NB_KEYS];
+	unsigned int len;
+	size_t i;
+
+	for (i = 0; i < NB_KEYS; i++)
+		keys[i] = ec_create();
+	for (i = 0; i < NB_SIGS; i++)
+	{
+		memset(msgs[i], (int)i, SHA256_DIGEST_LENGTH);
+		ec_sign(keys[i % NB_KEYS], msgs[i], SHA256_DIGEST_LENGTH, &sigs[i]);
+		ec_to_pub(keys[i % NB_KEYS], items[i].pub);
+		items[i].msg = msgs[i], items[i].msglen = SHA256_DIGEST_LENGTH;
+		items[i].sig = &sigs[i];
+	}
+
+	_print_result("Empty", items, 0);
+	_print_result("One signature", items, 1);
+	_print_result("All signatures", items, NB_SIGS);
+	_bench(items, NB_SIGS);
+
+	/* Two signatures from the wrong key, the first one must be reported */
+	ec_to_pub(keys[0], items[83].pub);
+	ec_to_pub(keys[0], items[37].pub);
+	_print_result("Wrong keys", items, NB_SIGS);
+	ec_to_pub(keys[37 % NB_KEYS], items[37].pub);
+	_print_result("Wrong key", items, NB_SIGS);
+	ec_to_pub(keys[83 % NB_KEYS], items[83].pub);
+
+	/* A message modified after it was signed */
+	msgs[64][0] ^= 1;
+	_print_result("Modified message", items, NB_SIGS);
+	msgs[64][0] ^= 1;
+
+	/* Valid signatures not normalized by ec_sign() */
+	for (i = 0; i < NB_SIGS; i++)
+	{
+		len = SIG_MAX_LEN;
+		ECDSA_sign(0, msgs[i], SHA256_DIGEST_LENGTH, sigs[i].sig, &len,
+				   keys[i % NB_KEYS]);
+		sigs[i].len = len;
+	}
+	_print_result("Not normalized", items, NB_SIGS);
+	sigs[90].sig[sigs[90].len - 1] ^= 1;
+	_print_result("Not normalized, modified signature", items, NB_SIGS);
+
+	for (i = 0; i < NB_KEYS; i++)
+		EC_KEY_free(keys[i]);
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,56 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "hblk_crypto.h"
+
+#define NB_KEYS 10
+#define NB_SIGS 100
+
+/**
+ * main - Entry point
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(void)
+{
+	unsigned int const nthreads[] = {1, 2, 4, 8, 0};
+	ec_verify_item_t items[NB_SIGS];
+	sig_t sigs[NB_SIGS];
+	uint8_t msgs[NB_SIGS][SHA256_DIGEST_LENGTH];
+	EC_KEY *keys[NB_KEYS];
+	size_t i, failure;
+	int valid;
+
+	for (i = 0; i < NB_KEYS; i++)
+		keys[i] = ec_create();
+	for (i = 0; i < NB_SIGS; i++)
+	{
+		memset(msgs[i], (int)i, SHA256_DIGEST_LENGTH);
+		ec_sign(keys[i % NB_KEYS], msgs[i], SHA256_DIGEST_LENGTH, &sigs[i]);
+		ec_to_pub(keys[i % NB_KEYS], items[i].pub);
+		items[i].msg = msgs[i], items[i].msglen = SHA256_DIGEST_LENGTH;
+		items[i].sig = &sigs[i];
+	}
+
+	for (i = 0; i < sizeof(nthreads) / sizeof(*nthreads); i++)
+	{
+		valid = ec_verify_parallel(items, NB_SIGS, nthreads[i], &failure);
+		printf("%u threads: valid %d, failure at %lu\n", nthreads[i], valid,
+			   failure);
+	}
+
+	/* Two signatures from the wrong key, the first one must be reported */
+	ec_to_pub(keys[0], items[80].pub);
+	ec_to_pub(keys[0], items[37].pub);
+	for (i = 0; i < sizeof(nthreads) / sizeof(*nthreads); i++)
+	{
+		valid = ec_verify_parallel(items, NB_SIGS, nthreads[i], &failure);
+		printf("%u threads: valid %d, failure at %lu\n", nthreads[i], valid,
+			   failure);
+	}
+
+	for (i = 0; i < NB_KEYS; i++)
+		EC_KEY_free(keys[i]);
+
+	return (EXIT_SUCCESS);
+}
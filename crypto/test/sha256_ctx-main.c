@@ -0,0 +1,63 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hblk_crypto.h"
+
+void _print_hex_buffer(uint8_t const *buf, size_t len);
+
+/**
+ * main - Entry point
+ *
+ * @ac: Arguments counter
+ * @av: Arguments vector
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	uint8_t hash[SHA256_DIGEST_LENGTH], expected[SHA256_DIGEST_LENGTH];
+	sha256_ctx_t ctx, copy;
+	size_t len, split;
+	int i;
+
+	if (ac < 2)
+	{
+		fprintf(stderr, "Usage: %s arg...\n", av[0]);
+		return (EXIT_FAILURE);
+	}
+
+	/* Feeding the arguments one by one hashes their concatenation */
+	sha256_init(&ctx);
+	for (i = 1; i < ac; i++)
+		sha256_update(&ctx, av[i], strlen(av[i]));
+	if (sha256_final(&ctx, hash) != hash)
+	{
+		fprintf(stderr, "sha256_final() failed\n");
+		return (EXIT_FAILURE);
+	}
+	printf("Hash of the arguments: ");
+	_print_hex_buffer(hash, SHA256_DIGEST_LENGTH);
+	printf("\n");
+
+	/* Any split of a message gives the hash of the whole message */
+	len = strlen(av[1]);
+	sha256((int8_t *)av[1], len, expected);
+	for (split = 0; split <= len; split++)
+	{
+		sha256_update(sha256_init(&ctx), av[1], split);
+		copy = ctx;
+		sha256_update(&copy, av[1] + split, len - split);
+		sha256_final(&copy, hash);
+		if (memcmp(hash, expected, SHA256_DIGEST_LENGTH))
+		{
+			fprintf(stderr, "Split at %lu differs\n", (unsigned long)split);
+			return (EXIT_FAILURE);
+		}
+	}
+	printf("\"%s\" hash is: ", av[1]);
+	_print_hex_buffer(expected, SHA256_DIGEST_LENGTH);
+	printf("\n");
+
+	return (EXIT_SUCCESS);
+}
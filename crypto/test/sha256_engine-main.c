@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hblk_crypto.h"
+
+void _print_hex_buffer(uint8_t const *buf, size_t len);
+
+#define BENCH_ROUNDS 200000
+#define MILLION_CHUNK 1000
+
+/* FIPS 180-4 example: one million repetitions of 'a' */
+static uint8_t const million_a[SHA256_DIGEST_LENGTH] = {
+	0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92,
+	0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+	0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e,
+	0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0
+};
+
+/* Lengths of a transaction output, a Block header and an input sequence */
+static size_t const bench_lengths[] = {32, 69, 88, 1024};
+
+/**
+ * _million - Hashes one million 'a' through a context, in chunks
+ * @engine: Pointer to the engine to use
+ *
+ * Return: 1 if the digest matches the known answer, 0 otherwise
+ */
+static int _million(sha256_engine_t const *engine)
+{
+	uint8_t chunk[MILLION_CHUNK], digest[SHA256_DIGEST_LENGTH];
+	sha256_ctx_t ctx;
+	int i;
+
+	memset(chunk, 'a', sizeof(chunk));
+	sha256_init_engine(&ctx, engine);
+	for (i = 0; i < 1000000 / MILLION_CHUNK; i++)
+		sha256_update(&ctx, chunk, sizeof(chunk));
+	sha256_final(&ctx, digest);
+
+	return (!memcmp(digest, million_a, SHA256_DIGEST_LENGTH));
+}
+
+/**
+ * _bench - Measures the number of messages hashed per second
+ * @engine: Pointer to the engine to measure, or NULL for OpenSSL SHA256()
+ * @len: Length of the messages in bytes
+ *
+ * Return: Number of hashes per second
+ */
+static double _bench(sha256_engine_t const *engine, size_t len)
+{
+	uint8_t msg[1024] = {0}, digest[SHA256_DIGEST_LENGTH];
+	unsigned int i;
+	clock_t start;
+
+	start = clock();
+	for (i = 0; i < BENCH_ROUNDS; i++)
+	{
+		memcpy(msg, &i, sizeof(i));
+		if (engine)
+			sha256_engine_hash(engine, msg, len, digest);
+		else
+			SHA256(msg, len, digest);
+		msg[4] ^= digest[0];
+	}
+
+	return ((double)BENCH_ROUNDS /
+			((double)(clock() - start) / CLOCKS_PER_SEC));
+}
+
+/**
+ * _print_bench - Prints the throughput of an engine for each length
+ * @name: Name to print
+ * @engine: Pointer to the engine to measure, or NULL for OpenSSL SHA256()
+ */
+static void _print_bench(char const *name, sha256_engine_t const *engine)
+{
+	size_t i;
+
+	printf("  %-8s", name);
+	for (i = 0; i < sizeof(bench_lengths) / sizeof(*bench_lengths); i++)
+		printf(" %4lu B: %9.0f/s", (unsigned long)bench_lengths[i],
+			   _bench(engine, bench_lengths[i]));
+	printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: Arguments counter
+ * @av: Arguments vector
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	sha256_engine_t const *engines = sha256_engines();
+	uint8_t digest[SHA256_DIGEST_LENGTH];
+	int i, ok, status = EXIT_SUCCESS;
+
+	for (i = 0; engines[i].name; i++)
+	{
+		if (!engines[i].supported())
+		{
+			printf("%s: not supported\n", engines[i].name);
+			continue;
+		}
+		ok = sha256_engine_selftest(&engines[i]);
+		ok = _million(&engines[i]) && ok;
+		if (!ok)
+			status = EXIT_FAILURE;
+		printf("%s: self-test %s\n", engines[i].name, ok ? "OK" : "FAILED");
+	}
+	printf("Selected engine: %s\n", sha256_engine()->name);
+
+	printf("Hashes per second:\n");
+	for (i = 0; engines[i].name; i++)
+		if (engines[i].supported())
+			_print_bench(engines[i].name, &engines[i]);
+	_print_bench("SHA256()", NULL);
+
+	if (ac > 1)
+	{
+		sha256((int8_t *)av[1], strlen(av[1]), digest);
+		printf("\"%s\" hash is: ", av[1]);
+		_print_hex_buffer(digest, SHA256_DIGEST_LENGTH);
+		printf("\n");
+	}
+
+	return (status);
+}
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "hblk_crypto.h"
+
+void _print_hex_buffer(uint8_t const *buf, size_t len);
+
+#define BENCH_LEN 88
+#define BENCH_ROUNDS 200000
+
+/**
+ * _bench - Measures the number of messages hashed per second by an engine
+ * @engine: Pointer to the engine to measure
+ *
+ * Return: Number of hashes per second
+ */
+static double _bench(sha256_mb_engine_t const *engine)
+{
+	uint8_t msgs[SHA256_MB_MAX_LANES][BENCH_LEN] = {{0}};
+	uint8_t const *ptrs[SHA256_MB_MAX_LANES];
+	uint8_t digests[SHA256_MB_MAX_LANES][SHA256_DIGEST_LENGTH];
+	unsigned int l, i;
+	clock_t start;
+
+	for (l = 0; l < engine->lanes; l++)
+		ptrs[l] = msgs[l];
+	start = clock();
+	for (i = 0; i < BENCH_ROUNDS; i++)
+	{
+		for (l = 0; l < engine->lanes; l++)
+			memcpy(msgs[l] + 16, &i, sizeof(i)), msgs[l][20] = l;
+		engine->hash(ptrs, BENCH_LEN, digests);
+	}
+
+	return ((double)BENCH_ROUNDS * engine->lanes /
+			((double)(clock() - start) / CLOCKS_PER_SEC));
+}
+
+/**
+ * main - Entry point
+ *
+ * @ac: Arguments counter
+ * @av: Arguments vector
+ *
+ * Return: EXIT_SUCCESS or EXIT_FAILURE
+ */
+int main(int ac, char **av)
+{
+	sha256_mb_engine_t const *engines = sha256_mb_engines();
+	int8_t const *msgs[2];
+	uint8_t digests[2][SHA256_DIGEST_LENGTH];
+	int i, status = EXIT_SUCCESS;
+
+	for (i = 0; engines[i].name; i++)
+	{
+		if (!engines[i].supported())
+		{
+			printf("%s: not supported\n", engines[i].name);
+			continue;
+		}
+		if (!sha256_mb_selftest(&engines[i]))
+			status = EXIT_FAILURE;
+		printf("%s: %u lanes, self-test %s, %.0f hashes/s\n",
+			   engines[i].name, engines[i].lanes,
+			   status == EXIT_SUCCESS ? "OK" : "FAILED", _bench(&engines[i]));
+	}
+	printf("Selected engine: %s\n", sha256_mb_engine()->name);
+
+	if (ac > 1)
+	{
+		msgs[0] = msgs[1] = (int8_t *)av[1];
+		sha256_mb(msgs, strlen(av[1]), 2, digests);
+		printf("\"%s\" hash is: ", av[1]);
+		_print_hex_buffer(digests[1], SHA256_DIGEST_LENGTH);
+		printf("\n");
+	}
+
+	return (status);
+}